@@ -0,0 +1,87 @@
+/**
+ * @file AggregatesBench.cpp
+ * @brief Compares summing through MyContainer::Order against the aggregates
+ *        kernels for each instruction set, on contiguous and permuted data.
+ *
+ * Usage: ./build/AggregatesBench [elements]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include "Aggregates.hpp"
+#include "MyContainer.hpp"
+
+using namespace my_container_project;
+
+namespace {
+
+template<typename F>
+double nsPerElement(size_t n, F&& body) {
+    auto start = std::chrono::steady_clock::now();
+    auto result = body();
+    auto stop = std::chrono::steady_clock::now();
+    volatile double sink = static_cast<double>(result);
+    (void)sink;
+    return std::chrono::duration<double, std::nano>(stop - start).count() / static_cast<double>(n);
+}
+
+void report(const char* name, double ns) {
+    std::cout << "  " << name << ": " << ns << " ns/element" << std::endl;
+}
+
+const char* isaName(aggregates::Isa isa) {
+    switch (isa) {
+        case aggregates::Isa::Avx2: return "AVX2";
+        case aggregates::Isa::Sse2: return "SSE2";
+        default: return "scalar";
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+    MyContainer<int> ints;
+    MyContainer<double> doubles;
+    std::mt19937 rng(42);
+    for (size_t i = 0; i < n; ++i) {
+        int v = static_cast<int>(rng() % 1000000);
+        ints.addElement(v);
+        doubles.addElement(v / 7.0);
+    }
+    const auto& index = ints.getSortedIndex();
+
+    std::cout << "Aggregates over " << n << " elements (detected: " << isaName(aggregates::detectIsa()) << ")" << std::endl;
+    std::cout << "int sum:" << std::endl;
+    report("Order iterator", nsPerElement(n, [&] {
+        long long s = 0;
+        MyContainer<int>::Order order(ints);
+        for (auto it = order.begin(); it != order.end(); ++it) s += *it;
+        return s;
+    }));
+    for (aggregates::Isa isa : {aggregates::Isa::Scalar, aggregates::Isa::Sse2, aggregates::Isa::Avx2}) {
+        aggregates::ScopedIsaLimit limit(isa);
+        report(isaName(aggregates::activeIsa()), nsPerElement(n, [&] { return aggregates::sum(ints); }));
+    }
+
+    std::cout << "double minmax / variance:" << std::endl;
+    for (aggregates::Isa isa : {aggregates::Isa::Scalar, aggregates::Isa::Sse2, aggregates::Isa::Avx2}) {
+        aggregates::ScopedIsaLimit limit(isa);
+        std::cout << "  " << isaName(aggregates::activeIsa()) << std::endl;
+        report("  minmax", nsPerElement(n, [&] { return aggregates::minmax(doubles).second; }));
+        report("  variance", nsPerElement(n, [&] { return aggregates::variance(doubles); }));
+    }
+
+    std::cout << "int sum through the sorted index (prefetched gather):" << std::endl;
+    report("gather", nsPerElement(n, [&] {
+        return aggregates::sum(aggregates::gather(ints.getElements().data(), index.data(), index.size()));
+    }));
+    report("plain loop", nsPerElement(n, [&] {
+        long long s = 0;
+        for (size_t i : index) s += ints.getElements()[i];
+        return s;
+    }));
+    return 0;
+}
@@ -0,0 +1,71 @@
+/**
+ * @file ExpiryBench.cpp
+ * @brief Streams elements with a TTL through a container: addElement(x, ttl)
+ *        plus advanceTime() once per tick, versus tracking deadlines outside
+ *        the container and calling remove() for each expired element.
+ *
+ * Usage: ./build/ExpiryBench [ticks] [elements per tick] [ttl]
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <iostream>
+#include <utility>
+#include "MyContainer.hpp"
+
+using namespace my_container_project;
+
+namespace {
+
+template<typename F>
+double millis(F&& body) {
+    auto start = std::chrono::steady_clock::now();
+    body();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    uint64_t ticks = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000;
+    size_t perTick = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 50;
+    uint64_t ttl = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 200;
+    std::cout << ticks << " ticks, " << perTick << " elements per tick, TTL " << ttl << std::endl;
+
+    // Distinct pseudo-random values, so remove() drops exactly one element
+    auto value = [](uint64_t i) { return static_cast<int>(static_cast<uint32_t>(i * 2654435761u)); };
+
+    MyContainer<int> viaRemove;
+    std::deque<std::pair<uint64_t, int>> deadlines; // Sorted by deadline: the TTL is fixed here
+    uint64_t next = 0;
+    double removeTime = millis([&] {
+        for (uint64_t now = 1; now <= ticks; ++now) {
+            while (!deadlines.empty() && deadlines.front().first <= now) {
+                viaRemove.remove(deadlines.front().second);
+                deadlines.pop_front();
+            }
+            for (size_t i = 0; i < perTick; ++i) {
+                const int v = value(next++);
+                viaRemove.addElement(v);
+                deadlines.emplace_back(now + ttl, v);
+            }
+        }
+    });
+
+    MyContainer<int> viaTtl;
+    next = 0;
+    double ttlTime = millis([&] {
+        for (uint64_t now = 1; now <= ticks; ++now) {
+            viaTtl.advanceTime(now);
+            for (size_t i = 0; i < perTick; ++i) viaTtl.addElement(value(next++), ttl);
+        }
+    });
+
+    std::cout << "  remove() per element:  " << removeTime << " ms (" << viaRemove.size() << " live)" << std::endl;
+    std::cout << "  advanceTime() batches: " << ttlTime << " ms (" << viaTtl.size() << " live)"
+              << (viaRemove.getElements() == viaTtl.getElements() ? "" : " MISMATCH") << std::endl;
+    return 0;
+}
@@ -0,0 +1,109 @@
+/**
+ * @file GeneratorBench.cpp
+ * @brief Compares per-element traversal cost of the coroutine generators
+ *        against the nested Iterator classes.
+ *
+ * Usage: ./build/GeneratorBench [elements]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include "MyContainer.hpp"
+
+using namespace my_container_project;
+
+namespace {
+
+template<typename F>
+double nsPerElement(size_t n, F&& body) {
+    auto start = std::chrono::steady_clock::now();
+    long long sum = body();
+    auto stop = std::chrono::steady_clock::now();
+    volatile long long sink = sum;
+    (void)sink;
+    return std::chrono::duration<double, std::nano>(stop - start).count() / static_cast<double>(n);
+}
+
+void report(const char* name, double ns) {
+    std::cout << "  " << name << ": " << ns << " ns/element" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000000;
+    MyContainer<int> c;
+    std::mt19937 rng(42);
+    for (size_t i = 0; i < n; ++i) c.addElement(static_cast<int>(rng() % 1000000));
+
+    std::cout << "Traversal of " << n << " ints" << std::endl;
+
+    std::cout << "Order:" << std::endl;
+    report("Iterator", nsPerElement(n, [&] {
+        long long s = 0;
+        MyContainer<int>::Order order(c);
+        for (auto it = order.begin(); it != order.end(); ++it) s += *it;
+        return s;
+    }));
+#if defined(__cpp_impl_coroutine)
+    report("Generator", nsPerElement(n, [&] {
+        long long s = 0;
+        for (const int& v : c.orderGenerator()) s += v;
+        return s;
+    }));
+#endif
+
+    std::cout << "MiddleOutOrder:" << std::endl;
+    report("Iterator", nsPerElement(n, [&] {
+        long long s = 0;
+        MyContainer<int>::MiddleOutOrder mid(c);
+        for (auto it = mid.begin(); it != mid.end(); ++it) s += *it;
+        return s;
+    }));
+#if defined(__cpp_impl_coroutine)
+    report("Generator", nsPerElement(n, [&] {
+        long long s = 0;
+        for (const int& v : c.middleOutGenerator()) s += v;
+        return s;
+    }));
+#endif
+
+    std::cout << "SideCrossOrder:" << std::endl;
+    report("Iterator", nsPerElement(n, [&] {
+        long long s = 0;
+        MyContainer<int>::SideCrossOrder cross(c);
+        for (auto it = cross.begin(); it != cross.end(); ++it) s += *it;
+        return s;
+    }));
+#if defined(__cpp_impl_coroutine)
+    report("Generator", nsPerElement(n, [&] {
+        long long s = 0;
+        for (const int& v : c.sideCrossGenerator()) s += v;
+        return s;
+    }));
+#endif
+
+    std::cout << "AscendingOrder (first 1% of elements):" << std::endl;
+    size_t k = n / 100 ? n / 100 : 1;
+    report("Iterator", nsPerElement(k, [&] {
+        long long s = 0;
+        MyContainer<int>::AscendingOrder asc(c);
+        auto it = asc.begin();
+        for (size_t i = 0; i < k && it != asc.end(); ++i, ++it) s += *it;
+        return s;
+    }));
+#if defined(__cpp_impl_coroutine)
+    report("Lazy generator", nsPerElement(k, [&] {
+        long long s = 0;
+        size_t i = 0;
+        for (const int& v : c.lazyAscendingGenerator()) {
+            s += v;
+            if (++i == k) break; // Stop at the k-th element without resuming for another
+        }
+        return s;
+    }));
+#endif
+    return 0;
+}
@@ -0,0 +1,69 @@
+/**
+ * @file MergeBench.cpp
+ * @brief Combines shard containers with merge() versus addElement() per
+ *        element, including the cost of the next AscendingOrder.
+ *
+ * Usage: ./build/MergeBench [elements per shard] [shards]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "MyContainer.hpp"
+
+using namespace my_container_project;
+
+namespace {
+
+template<typename F>
+double millis(F&& body) {
+    auto start = std::chrono::steady_clock::now();
+    body();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+template<typename T, typename Make>
+std::vector<MyContainer<T>> makeShards(size_t perShard, size_t shards, Make make) {
+    std::mt19937 rng(42);
+    std::vector<MyContainer<T>> result(shards);
+    for (auto& shard : result) {
+        for (size_t i = 0; i < perShard; ++i) shard.addElement(make(rng));
+        shard.getSortedIndex(); // Each shard has already served a sorted view
+    }
+    return result;
+}
+
+template<typename T, typename Make>
+void compare(const char* name, size_t perShard, size_t shards, Make make) {
+    auto copied = makeShards<T>(perShard, shards, make);
+    auto moved = makeShards<T>(perShard, shards, make);
+    MyContainer<T> viaAdd, viaMerge;
+    double addTime = millis([&] {
+        for (auto& shard : copied)
+            for (const T& v : shard.getElements()) viaAdd.addElement(v);
+    });
+    double addSortTime = millis([&] { viaAdd.getSortedIndex(); });
+    double mergeTime = millis([&] {
+        for (auto& shard : moved) viaMerge.merge(std::move(shard));
+    });
+    double mergeSortTime = millis([&] { viaMerge.getSortedIndex(); });
+    std::cout << "  " << name << ": addElement " << addTime << " ms + sort " << addSortTime << " ms; merge "
+              << mergeTime << " ms + sort " << mergeSortTime << " ms"
+              << (viaAdd.getSortedIndex() == viaMerge.getSortedIndex() ? "" : " MISMATCH") << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t perShard = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 250000;
+    size_t shards = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 4;
+    std::cout << shards << " shards of " << perShard << " elements" << std::endl;
+    compare<int>("int   ", perShard, shards, [](std::mt19937& rng) { return static_cast<int>(rng()); });
+    compare<std::string>("string", perShard, shards,
+                         [](std::mt19937& rng) { return "key-" + std::to_string(rng() % 100000000); });
+    return 0;
+}
@@ -0,0 +1,62 @@
+/**
+ * @file QuantileBench.cpp
+ * @brief Compares KLL sketch quantiles against exact quantiles from the
+ *        sorted index (the cost of building an AscendingOrder).
+ *
+ * Usage: ./build/QuantileBench [elements] [k]
+ * (e.g. ./build/QuantileBench 100000000 for the 100M-element comparison)
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include "MyContainer.hpp"
+
+using namespace my_container_project;
+
+namespace {
+
+template<typename F>
+double seconds(F&& body) {
+    auto start = std::chrono::steady_clock::now();
+    body();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(stop - start).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+    size_t k = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : KllSketch<int>::kDefaultK;
+    std::mt19937 rng(42);
+    std::vector<int> input(n);
+    for (auto& v : input) v = static_cast<int>(rng() % 1000000000);
+
+    MyContainer<int> plain, sketched;
+    sketched.enableQuantileSketch(k);
+    double plainAdd = seconds([&] { for (int v : input) plain.addElement(v); });
+    double sketchAdd = seconds([&] { for (int v : input) sketched.addElement(v); });
+
+    const double qs[] = {0.5, 0.9, 0.99};
+    int exact[3], approx[3];
+    double exactTime = seconds([&] {
+        const auto& index = plain.getSortedIndex();
+        for (int i = 0; i < 3; ++i) exact[i] = plain.getElements()[index[static_cast<size_t>(qs[i] * (n - 1))]];
+    });
+    double approxTime = seconds([&] { for (int i = 0; i < 3; ++i) approx[i] = sketched.approxQuantile(qs[i]); });
+
+    const KllSketch<int>& sketch = sketched.getQuantileSketch();
+    std::cout << n << " ints, k = " << k << " (expected rank error ~" << sketch.normalizedRankError() << ")" << std::endl;
+    std::cout << "  addElement: " << plainAdd * 1e9 / n << " ns plain, " << sketchAdd * 1e9 / n << " ns with sketch" << std::endl;
+    std::cout << "  sketch memory: " << sketch.retainedCount() << " values (" << sketch.retainedCount() * sizeof(int)
+              << " bytes) vs sorted index " << n * sizeof(size_t) << " bytes" << std::endl;
+    std::cout << "  exact p50/p90/p99 via sorted index: " << exactTime * 1e3 << " ms" << std::endl;
+    std::cout << "  sketch p50/p90/p99: " << approxTime * 1e3 << " ms" << std::endl;
+    for (int i = 0; i < 3; ++i)
+        std::cout << "    q=" << qs[i] << " exact " << exact[i] << " approx " << approx[i]
+                  << " (rank error " << std::abs(plain.approxRank(approx[i]) - qs[i]) << ")" << std::endl;
+    return 0;
+}
@@ -0,0 +1,87 @@
+/**
+ * @file SetAlgebraBench.cpp
+ * @brief Compares intersectWith/differenceWith against the hand-written merge
+ *        of two AscendingOrder views, for similar and for skewed sizes, and
+ *        the SSE2 block kernel for distinct 32-bit integers.
+ *
+ * Usage: ./build/SetAlgebraBench [elements]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "MyContainer.hpp"
+
+using namespace my_container_project;
+
+namespace {
+
+template<typename F>
+double millis(F&& body, int reps = 5) {
+    double best = 1e300;
+    for (int r = 0; r < reps; ++r) {
+        auto start = std::chrono::steady_clock::now();
+        body();
+        auto stop = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::milli>(stop - start).count());
+    }
+    return best;
+}
+
+MyContainer<int> randomContainer(size_t n, uint32_t range, uint32_t seed, bool unique) {
+    std::mt19937 rng(seed);
+    MyContainer<int> c;
+    if (unique) c.enableUniqueElements();
+    while (c.size() < n) c.addElement(static_cast<int>(rng() % range));
+    return c;
+}
+
+/**
+ * @brief What callers wrote before: two sorted views and a hand-written merge.
+ */
+size_t handIntersection(MyContainer<int>& a, MyContainer<int>& b) {
+    MyContainer<int>::AscendingOrder x(a), y(b);
+    std::vector<int> out;
+    auto i = x.begin(), ie = x.end();
+    auto j = y.begin(), je = y.end();
+    while (i != ie && j != je) {
+        if (*i < *j) ++i;
+        else if (*j < *i) ++j;
+        else { out.push_back(*i); ++i; ++j; }
+    }
+    return out.size();
+}
+
+void compare(const char* name, MyContainer<int>& a, MyContainer<int>& b) {
+    a.getSortedIndex();
+    b.getSortedIndex();
+    size_t hand = 0, built = 0, streamed = 0;
+    double handTime = millis([&] { hand = handIntersection(a, b); });
+    double builtTime = millis([&] { built = a.intersectWith(b).size(); });
+    double streamTime = millis([&] { streamed = 0; a.intersectWith(b, [&streamed](int) { ++streamed; }); });
+    double diffTime = millis([&] { a.differenceWith(b); });
+    std::cout << "  " << name << " (" << a.size() << " x " << b.size() << ", " << built << " common): hand merge "
+              << handTime << " ms, intersectWith " << builtTime << " ms, streaming " << streamTime
+              << " ms, differenceWith " << diffTime << " ms" << (hand == built && built == streamed ? "" : " MISMATCH")
+              << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    const uint32_t range = static_cast<uint32_t>(4 * n);
+
+    MyContainer<int> a = randomContainer(n, range, 1, false), b = randomContainer(n, range, 2, false);
+    compare("similar sizes", a, b);
+    MyContainer<int> few = randomContainer(n / 1000, range, 3, false);
+    compare("skewed sizes ", few, a);
+
+    MyContainer<int> ua = randomContainer(n, range, 1, true), ub = randomContainer(n, range, 2, true);
+    compare("distinct, SSE2  ", ua, ub);
+    aggregates::ScopedIsaLimit scalar(aggregates::Isa::Scalar);
+    compare("distinct, scalar", ua, ub);
+    return 0;
+}
@@ -0,0 +1,75 @@
+/**
+ * @file SketchBench.cpp
+ * @brief Measures the memory overhead and speedup of the membership filter
+ *        (contains/remove of absent elements) and the distinct counter.
+ *
+ * Usage: ./build/SketchBench [elements]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include "MyContainer.hpp"
+
+using namespace my_container_project;
+
+namespace {
+
+template<typename F>
+double seconds(F&& body) {
+    auto start = std::chrono::steady_clock::now();
+    body();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(stop - start).count();
+}
+
+/**
+ * @brief Time per call of contains() and of remove() for values that are absent.
+ */
+void probeAbsent(MyContainer<int>& c, const char* name, int probes) {
+    size_t found = 0;
+    double containsTime = seconds([&] {
+        for (int i = 0; i < probes; ++i) found += c.contains(-1 - i);
+    });
+    double removeTime = seconds([&] {
+        for (int i = 0; i < probes; ++i) {
+            try {
+                c.remove(-1 - i);
+            } catch (const std::runtime_error&) {
+            }
+        }
+    });
+    std::cout << "  " << name << ": contains " << containsTime * 1e6 / probes << " us, remove "
+              << removeTime * 1e6 / probes << " us per absent value (" << found << " false hits)" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    std::mt19937 rng(42);
+    MyContainer<int> plain, filtered;
+    filtered.enableMembershipFilter(n);
+    filtered.enableDistinctCounter();
+    double plainAdd = seconds([&] { for (size_t i = 0; i < n; ++i) plain.addElement(static_cast<int>(rng() % (n / 2))); });
+    rng.seed(42);
+    double filteredAdd = seconds([&] { for (size_t i = 0; i < n; ++i) filtered.addElement(static_cast<int>(rng() % (n / 2))); });
+
+    std::cout << n << " ints (" << n * sizeof(int) << " bytes of elements)" << std::endl;
+    std::cout << "  addElement: " << plainAdd * 1e9 / n << " ns plain, " << filteredAdd * 1e9 / n
+              << " ns with Bloom filter + HyperLogLog" << std::endl;
+    std::cout << "  Bloom filter: " << filtered.membershipFilterMemory() << " bytes; HyperLogLog: "
+              << (size_t(1) << HyperLogLog<int>::kDefaultPrecision) << " bytes" << std::endl;
+
+    probeAbsent(plain, "linear scan ", 200);
+    probeAbsent(filtered, "Bloom filter", 200);
+
+    double exact = 0, approx = 0;
+    double exactTime = seconds([&] { exact = plain.approxDistinct(); });
+    double approxTime = seconds([&] { approx = filtered.approxDistinct(); });
+    std::cout << "  distinct: exact " << exact << " in " << exactTime * 1e3 << " ms (sort), HyperLogLog " << approx
+              << " in " << approxTime * 1e3 << " ms" << std::endl;
+    return 0;
+}
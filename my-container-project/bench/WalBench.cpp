@@ -0,0 +1,83 @@
+/**
+ * @file WalBench.cpp
+ * @brief Measures DurableMyContainer::addElement throughput with and without
+ *        group commit, and how long an idle record waits when the owner polls.
+ *
+ * Usage: ./build/WalBench [operations] [directory]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include "DurableMyContainer.hpp"
+
+using namespace my_container_project;
+
+namespace {
+
+double opsPerSecond(size_t ops, const std::string& dir, const WalOptions& options) {
+    const std::string snapshot = dir + "/walbench.snap", log = dir + "/walbench.log";
+    std::remove(snapshot.c_str());
+    std::remove(log.c_str());
+    auto start = std::chrono::steady_clock::now();
+    {
+        DurableMyContainer<int> d(snapshot, log, options);
+        for (size_t i = 0; i < ops; ++i) d.addElement(static_cast<int>(i));
+        d.sync();
+    }
+    auto stop = std::chrono::steady_clock::now();
+    std::remove(snapshot.c_str());
+    std::remove(log.c_str());
+    return static_cast<double>(ops) / std::chrono::duration<double>(stop - start).count();
+}
+
+/**
+ * @brief Worst time a lone record stays unsynced on an otherwise idle
+ *        container, when the owner calls poll() every pollInterval.
+ */
+double worstIdleLatencyMs(const std::string& dir, const WalOptions& options, std::chrono::microseconds pollInterval) {
+    const std::string snapshot = dir + "/walbench.snap", log = dir + "/walbench.log";
+    std::remove(snapshot.c_str());
+    std::remove(log.c_str());
+    double worst = 0;
+    {
+        DurableMyContainer<int> d(snapshot, log, options);
+        for (int i = 0; i < 20; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            d.addElement(i);
+            while (d.pendingCount() != 0) {
+                std::this_thread::sleep_for(pollInterval);
+                d.poll();
+            }
+            auto stop = std::chrono::steady_clock::now();
+            worst = std::max(worst, std::chrono::duration<double, std::milli>(stop - start).count());
+        }
+    }
+    std::remove(snapshot.c_str());
+    std::remove(log.c_str());
+    return worst;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t ops = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000;
+    std::string dir = argc > 2 ? argv[2] : "build";
+
+    WalOptions everyRecord;
+    everyRecord.maxPendingRecords = 1;
+    WalOptions grouped;
+    grouped.maxPendingRecords = 256;
+    grouped.maxPendingTime = std::chrono::milliseconds(5);
+
+    std::cout << "addElement with write-ahead log (" << ops << " operations)" << std::endl;
+    std::cout << "  fsync per record: " << opsPerSecond(ops, dir, everyRecord) << " ops/s" << std::endl;
+    std::cout << "  group commit (256 records / 5 ms): " << opsPerSecond(ops * 100, dir, grouped) << " ops/s" << std::endl;
+    std::cout << "Idle record, worst time until durable (group commit, poll() every 1 ms): "
+              << worstIdleLatencyMs(dir, grouped, std::chrono::milliseconds(1)) << " ms" << std::endl;
+    return 0;
+}
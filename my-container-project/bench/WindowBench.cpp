@@ -0,0 +1,70 @@
+/**
+ * @file WindowBench.cpp
+ * @brief Sliding-window median: WindowedMyContainer (O(log N) per update)
+ *        versus re-selecting the median of a copied window per update.
+ *
+ * Usage: ./build/WindowBench [window] [samples]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "WindowedMyContainer.hpp"
+
+using namespace my_container_project;
+
+namespace {
+
+template<typename F>
+double seconds(F&& body) {
+    auto start = std::chrono::steady_clock::now();
+    body();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(stop - start).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t window = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000;
+    size_t samples = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1000000;
+    std::mt19937 rng(42);
+    std::vector<int> input(samples);
+    for (auto& v : input) v = static_cast<int>(rng() % 1000000);
+
+    long long treeSum = 0, copySum = 0;
+    WindowedMyContainer<int> w(window);
+    double treeTime = seconds([&] {
+        for (int v : input) {
+            w.addElement(v);
+            treeSum += w.median();
+        }
+    });
+
+    // Baseline: the window in a deque, median re-selected from a copy (only
+    // measured on the tail of the stream, where the window is full).
+    const size_t baselineSteps = std::min<size_t>(samples, 2000);
+    std::deque<int> recent(input.end() - static_cast<std::ptrdiff_t>(std::min(samples, window + baselineSteps)),
+                           input.end() - static_cast<std::ptrdiff_t>(baselineSteps));
+    std::vector<int> scratch;
+    double copyTime = seconds([&] {
+        for (size_t i = samples - baselineSteps; i < samples; ++i) {
+            recent.push_back(input[i]);
+            if (recent.size() > window) recent.pop_front();
+            scratch.assign(recent.begin(), recent.end());
+            auto mid = scratch.begin() + static_cast<std::ptrdiff_t>((scratch.size() - 1) / 2);
+            std::nth_element(scratch.begin(), mid, scratch.end());
+            copySum += *mid;
+        }
+    });
+
+    std::cout << "window " << window << ", " << samples << " samples (checksum " << treeSum << ")" << std::endl;
+    std::cout << "  WindowedMyContainer add + median: " << treeTime * 1e9 / samples << " ns per sample" << std::endl;
+    std::cout << "  copy + nth_element per sample:    " << copyTime * 1e9 / baselineSteps << " ns per sample (checksum "
+              << copySum << ")" << std::endl;
+    return 0;
+}
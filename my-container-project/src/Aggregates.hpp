@@ -0,0 +1,590 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define MY_CONTAINER_AGGREGATES_X86 1
+#include <immintrin.h>
+#endif
+
+namespace my_container_project {
+namespace aggregates {
+
+/**
+ * @brief Instruction set used by the kernels.
+ */
+enum class Isa { Scalar, Sse2, Avx2 };
+
+/**
+ * @brief Best instruction set supported by the running CPU (checked once).
+ */
+inline Isa detectIsa() {
+#if defined(MY_CONTAINER_AGGREGATES_X86)
+    static const Isa detected = [] {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") ? Isa::Avx2 : Isa::Sse2;
+    }();
+    return detected;
+#else
+    return Isa::Scalar;
+#endif
+}
+
+namespace detail {
+inline Isa& isaLimit() {
+    thread_local Isa limit = Isa::Avx2;
+    return limit;
+}
+} // namespace detail
+
+/**
+ * @brief Instruction set the kernels dispatch to on the calling thread: the
+ *        detected one, capped by the innermost live ScopedIsaLimit.
+ */
+inline Isa activeIsa() { return std::min(detectIsa(), detail::isaLimit()); }
+
+/**
+ * @brief Caps the instruction set used by the kernels on the calling thread
+ *        while alive, restoring the previous cap on destruction (for tests and
+ *        benchmarks). Other threads keep dispatching to the detected instruction set.
+ * Requests beyond what the CPU supports fall back to the detected instruction set.
+ */
+class ScopedIsaLimit {
+    Isa previous;
+
+public:
+    explicit ScopedIsaLimit(Isa limit) : previous(detail::isaLimit()) { detail::isaLimit() = limit; }
+    ~ScopedIsaLimit() { detail::isaLimit() = previous; }
+    ScopedIsaLimit(const ScopedIsaLimit&) = delete;
+    ScopedIsaLimit& operator=(const ScopedIsaLimit&) = delete;
+};
+
+/**
+ * @brief Contiguous range of elements.
+ */
+template<typename T>
+struct Span {
+    const T* data;
+    size_t size;
+};
+
+/**
+ * @brief Elements reached through a permutation: base[index[0]], base[index[1]], ...
+ * Used for permutation-backed views such as MyContainer::getSortedIndex().
+ */
+template<typename T>
+struct Gather {
+    const T* base;
+    const size_t* index;
+    size_t size;
+};
+
+template<typename T>
+Span<T> span(const T* data, size_t n) { return Span<T>{data, n}; }
+
+template<typename T>
+Gather<T> gather(const T* base, const size_t* index, size_t n) { return Gather<T>{base, index, n}; }
+
+/// Accumulator type of sum(): 64-bit integers for integral T, at least double otherwise.
+template<typename T>
+using sum_type = typename std::conditional<std::is_floating_point<T>::value, typename std::common_type<T, double>::type,
+                 typename std::conditional<std::is_signed<T>::value, int64_t, uint64_t>::type>::type;
+
+namespace detail {
+
+/// Elements copied per block when reading through a permutation or an iterator.
+constexpr size_t kBlockSize = 256;
+/// How many positions ahead permutation reads are prefetched.
+constexpr size_t kPrefetchDistance = 16;
+
+template<typename S, typename = void>
+struct ElementOf {
+    using type = typename std::decay<decltype(*std::begin(std::declval<S&>()))>::type;
+};
+template<typename T>
+struct ElementOf<Span<T>, void> { using type = T; };
+template<typename T>
+struct ElementOf<Gather<T>, void> { using type = T; };
+template<typename S>
+struct ElementOf<S, std::void_t<decltype(std::declval<const S&>().getElements())>> {
+    using type = typename std::decay<decltype(std::declval<const S&>().getElements()[0])>::type;
+};
+
+template<typename S>
+struct IsSpan : std::false_type {};
+template<typename T>
+struct IsSpan<Span<T>> : std::true_type {};
+template<typename S>
+struct IsGather : std::false_type {};
+template<typename T>
+struct IsGather<Gather<T>> : std::true_type {};
+
+template<typename S, typename = void>
+struct HasElements : std::false_type {};
+template<typename S>
+struct HasElements<S, std::void_t<decltype(std::declval<const S&>().getElements())>> : std::true_type {};
+
+template<typename S, typename = void>
+struct HasData : std::false_type {};
+template<typename S>
+struct HasData<S, std::void_t<decltype(std::declval<const S&>().data()), decltype(std::declval<const S&>().size())>>
+    : std::is_pointer<decltype(std::declval<const S&>().data())> {};
+
+template<typename S, typename = void>
+struct HasMinMax : std::false_type {};
+template<typename S>
+struct HasMinMax<S, std::void_t<decltype(std::declval<const S&>().min()), decltype(std::declval<const S&>().max())>>
+    : std::true_type {};
+
+/**
+ * @brief Calls f(pointer, count) over contiguous blocks covering the source.
+ * Contiguous sources are passed through; permutations and other ranges are
+ * copied into a stack buffer, prefetching permutation targets ahead.
+ */
+template<typename Source, typename F>
+void forEachBlock(Source&& source, F&& f) {
+    using S = typename std::decay<Source>::type;
+    using T = typename ElementOf<S>::type;
+    if constexpr (IsSpan<S>::value) {
+        if (source.size) f(source.data, source.size);
+    } else if constexpr (IsGather<S>::value) {
+        std::array<T, kBlockSize> block;
+        for (size_t i = 0; i < source.size; i += kBlockSize) {
+            size_t m = std::min(kBlockSize, source.size - i);
+            for (size_t j = 0; j < m; ++j) {
+#if defined(__GNUC__)
+                if (i + j + kPrefetchDistance < source.size)
+                    __builtin_prefetch(source.base + source.index[i + j + kPrefetchDistance]);
+#endif
+                block[j] = source.base[source.index[i + j]];
+            }
+            f(block.data(), m);
+        }
+    } else if constexpr (HasElements<S>::value) {
+        const auto& elements = source.getElements();
+        if (!elements.empty()) f(elements.data(), elements.size());
+    } else if constexpr (HasData<S>::value) {
+        if (source.size()) f(source.data(), source.size());
+    } else {
+        std::array<T, kBlockSize> block;
+        size_t m = 0;
+        for (const auto& v : source) {
+            block[m++] = v;
+            if (m == kBlockSize) {
+                f(block.data(), m);
+                m = 0;
+            }
+        }
+        if (m) f(block.data(), m);
+    }
+}
+
+// ---- Scalar kernels -------------------------------------------------------
+
+template<typename T>
+sum_type<T> sumScalar(const T* p, size_t n) {
+    sum_type<T> s = 0;
+    for (size_t i = 0; i < n; ++i) s += p[i];
+    return s;
+}
+
+template<typename T>
+void minMaxScalar(const T* p, size_t n, T& lo, T& hi) {
+    for (size_t i = 0; i < n; ++i) {
+        if (p[i] < lo) lo = p[i];
+        if (hi < p[i]) hi = p[i];
+    }
+}
+
+template<typename T>
+double squaredDeviationScalar(const T* p, size_t n, double mean) {
+    double s = 0;
+    for (size_t i = 0; i < n; ++i) {
+        double d = static_cast<double>(p[i]) - mean;
+        s += d * d;
+    }
+    return s;
+}
+
+#if defined(MY_CONTAINER_AGGREGATES_X86)
+
+template<typename T>
+constexpr bool hasSimdKernels =
+    std::is_same<T, int32_t>::value || std::is_same<T, float>::value || std::is_same<T, double>::value;
+
+// ---- SSE2 kernels (baseline on x86-64) ------------------------------------
+
+/**
+ * @brief Loads two elements widened to doubles.
+ */
+inline __m128d loadPd2(const int32_t* p) { return _mm_cvtepi32_pd(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p))); }
+inline __m128d loadPd2(const float* p) { return _mm_cvtps_pd(_mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)))); }
+inline __m128d loadPd2(const double* p) { return _mm_loadu_pd(p); }
+
+inline double horizontalSum(__m128d v) {
+    alignas(16) double lanes[2];
+    _mm_store_pd(lanes, v);
+    return lanes[0] + lanes[1];
+}
+
+inline int64_t sumSse2(const int32_t* p, size_t n) {
+    __m128i acc = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        __m128i sign = _mm_srai_epi32(v, 31);
+        acc = _mm_add_epi64(acc, _mm_add_epi64(_mm_unpacklo_epi32(v, sign), _mm_unpackhi_epi32(v, sign)));
+    }
+    alignas(16) int64_t lanes[2];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+    return lanes[0] + lanes[1] + sumScalar(p + i, n - i);
+}
+
+template<typename T>
+double sumSse2(const T* p, size_t n) {
+    __m128d acc0 = _mm_setzero_pd(), acc1 = _mm_setzero_pd();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        acc0 = _mm_add_pd(acc0, loadPd2(p + i));
+        acc1 = _mm_add_pd(acc1, loadPd2(p + i + 2));
+    }
+    return horizontalSum(_mm_add_pd(acc0, acc1)) + sumScalar(p + i, n - i);
+}
+
+template<typename T>
+double squaredDeviationSse2(const T* p, size_t n, double mean) {
+    const __m128d m = _mm_set1_pd(mean);
+    __m128d acc0 = _mm_setzero_pd(), acc1 = _mm_setzero_pd();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128d d0 = _mm_sub_pd(loadPd2(p + i), m);
+        __m128d d1 = _mm_sub_pd(loadPd2(p + i + 2), m);
+        acc0 = _mm_add_pd(acc0, _mm_mul_pd(d0, d0));
+        acc1 = _mm_add_pd(acc1, _mm_mul_pd(d1, d1));
+    }
+    return horizontalSum(_mm_add_pd(acc0, acc1)) + squaredDeviationScalar(p + i, n - i, mean);
+}
+
+/**
+ * @brief SSE2 vector operations per element type (int32 min/max emulated; pminsd is SSE4.1).
+ */
+template<typename T>
+struct Sse2Ops;
+
+template<>
+struct Sse2Ops<int32_t> {
+    using V = __m128i;
+    static constexpr size_t kLanes = 4;
+    static V load(const int32_t* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+    static V set1(int32_t v) { return _mm_set1_epi32(v); }
+    static V min(V a, V b) { V gt = _mm_cmpgt_epi32(a, b); return _mm_or_si128(_mm_and_si128(gt, b), _mm_andnot_si128(gt, a)); }
+    static V max(V a, V b) { V gt = _mm_cmpgt_epi32(a, b); return _mm_or_si128(_mm_and_si128(gt, a), _mm_andnot_si128(gt, b)); }
+    static void store(int32_t* p, V v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+};
+
+template<>
+struct Sse2Ops<float> {
+    using V = __m128;
+    static constexpr size_t kLanes = 4;
+    static V load(const float* p) { return _mm_loadu_ps(p); }
+    static V set1(float v) { return _mm_set1_ps(v); }
+    static V min(V a, V b) { return _mm_min_ps(a, b); }
+    static V max(V a, V b) { return _mm_max_ps(a, b); }
+    static void store(float* p, V v) { _mm_storeu_ps(p, v); }
+};
+
+template<>
+struct Sse2Ops<double> {
+    using V = __m128d;
+    static constexpr size_t kLanes = 2;
+    static V load(const double* p) { return _mm_loadu_pd(p); }
+    static V set1(double v) { return _mm_set1_pd(v); }
+    static V min(V a, V b) { return _mm_min_pd(a, b); }
+    static V max(V a, V b) { return _mm_max_pd(a, b); }
+    static void store(double* p, V v) { _mm_storeu_pd(p, v); }
+};
+
+template<typename T>
+void minMaxSse2(const T* p, size_t n, T& lo, T& hi) {
+    using Ops = Sse2Ops<T>;
+    typename Ops::V vlo = Ops::set1(lo), vhi = Ops::set1(hi);
+    size_t i = 0;
+    for (; i + Ops::kLanes <= n; i += Ops::kLanes) {
+        typename Ops::V v = Ops::load(p + i);
+        vlo = Ops::min(vlo, v);
+        vhi = Ops::max(vhi, v);
+    }
+    T lanes[Ops::kLanes];
+    Ops::store(lanes, vlo);
+    minMaxScalar(lanes, Ops::kLanes, lo, hi);
+    Ops::store(lanes, vhi);
+    minMaxScalar(lanes, Ops::kLanes, lo, hi);
+    minMaxScalar(p + i, n - i, lo, hi);
+}
+
+// ---- AVX2 kernels (selected at run time) ----------------------------------
+
+#define MY_CONTAINER_AVX2 __attribute__((target("avx2")))
+
+MY_CONTAINER_AVX2 inline __m256d loadPd4(const int32_t* p) { return _mm256_cvtepi32_pd(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))); }
+MY_CONTAINER_AVX2 inline __m256d loadPd4(const float* p) { return _mm256_cvtps_pd(_mm_loadu_ps(p)); }
+MY_CONTAINER_AVX2 inline __m256d loadPd4(const double* p) { return _mm256_loadu_pd(p); }
+
+MY_CONTAINER_AVX2 inline double horizontalSum(__m256d v) {
+    alignas(32) double lanes[4];
+    _mm256_store_pd(lanes, v);
+    return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+}
+
+MY_CONTAINER_AVX2 inline int64_t sumAvx2(const int32_t* p, size_t n) {
+    __m256i acc0 = _mm256_setzero_si256(), acc1 = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+        acc0 = _mm256_add_epi64(acc0, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+        acc1 = _mm256_add_epi64(acc1, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+    }
+    alignas(32) int64_t lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), _mm256_add_epi64(acc0, acc1));
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + sumScalar(p + i, n - i);
+}
+
+template<typename T>
+MY_CONTAINER_AVX2 double sumAvx2(const T* p, size_t n) {
+    __m256d acc0 = _mm256_setzero_pd(), acc1 = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        acc0 = _mm256_add_pd(acc0, loadPd4(p + i));
+        acc1 = _mm256_add_pd(acc1, loadPd4(p + i + 4));
+    }
+    return horizontalSum(_mm256_add_pd(acc0, acc1)) + sumScalar(p + i, n - i);
+}
+
+template<typename T>
+MY_CONTAINER_AVX2 double squaredDeviationAvx2(const T* p, size_t n, double mean) {
+    const __m256d m = _mm256_set1_pd(mean);
+    __m256d acc0 = _mm256_setzero_pd(), acc1 = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256d d0 = _mm256_sub_pd(loadPd4(p + i), m);
+        __m256d d1 = _mm256_sub_pd(loadPd4(p + i + 4), m);
+        acc0 = _mm256_add_pd(acc0, _mm256_mul_pd(d0, d0));
+        acc1 = _mm256_add_pd(acc1, _mm256_mul_pd(d1, d1));
+    }
+    return horizontalSum(_mm256_add_pd(acc0, acc1)) + squaredDeviationScalar(p + i, n - i, mean);
+}
+
+/**
+ * @brief AVX2 vector operations per element type.
+ */
+template<typename T>
+struct Avx2Ops;
+
+template<>
+struct Avx2Ops<int32_t> {
+    using V = __m256i;
+    static constexpr size_t kLanes = 8;
+    MY_CONTAINER_AVX2 static V load(const int32_t* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    MY_CONTAINER_AVX2 static V set1(int32_t v) { return _mm256_set1_epi32(v); }
+    MY_CONTAINER_AVX2 static V min(V a, V b) { return _mm256_min_epi32(a, b); }
+    MY_CONTAINER_AVX2 static V max(V a, V b) { return _mm256_max_epi32(a, b); }
+    MY_CONTAINER_AVX2 static void store(int32_t* p, V v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+};
+
+template<>
+struct Avx2Ops<float> {
+    using V = __m256;
+    static constexpr size_t kLanes = 8;
+    MY_CONTAINER_AVX2 static V load(const float* p) { return _mm256_loadu_ps(p); }
+    MY_CONTAINER_AVX2 static V set1(float v) { return _mm256_set1_ps(v); }
+    MY_CONTAINER_AVX2 static V min(V a, V b) { return _mm256_min_ps(a, b); }
+    MY_CONTAINER_AVX2 static V max(V a, V b) { return _mm256_max_ps(a, b); }
+    MY_CONTAINER_AVX2 static void store(float* p, V v) { _mm256_storeu_ps(p, v); }
+};
+
+template<>
+struct Avx2Ops<double> {
+    using V = __m256d;
+    static constexpr size_t kLanes = 4;
+    MY_CONTAINER_AVX2 static V load(const double* p) { return _mm256_loadu_pd(p); }
+    MY_CONTAINER_AVX2 static V set1(double v) { return _mm256_set1_pd(v); }
+    MY_CONTAINER_AVX2 static V min(V a, V b) { return _mm256_min_pd(a, b); }
+    MY_CONTAINER_AVX2 static V max(V a, V b) { return _mm256_max_pd(a, b); }
+    MY_CONTAINER_AVX2 static void store(double* p, V v) { _mm256_storeu_pd(p, v); }
+};
+
+template<typename T>
+MY_CONTAINER_AVX2 void minMaxAvx2(const T* p, size_t n, T& lo, T& hi) {
+    using Ops = Avx2Ops<T>;
+    typename Ops::V vlo = Ops::set1(lo), vhi = Ops::set1(hi);
+    size_t i = 0;
+    for (; i + Ops::kLanes <= n; i += Ops::kLanes) {
+        typename Ops::V v = Ops::load(p + i);
+        vlo = Ops::min(vlo, v);
+        vhi = Ops::max(vhi, v);
+    }
+    T lanes[Ops::kLanes];
+    Ops::store(lanes, vlo);
+    minMaxScalar(lanes, Ops::kLanes, lo, hi);
+    Ops::store(lanes, vhi);
+    minMaxScalar(lanes, Ops::kLanes, lo, hi);
+    minMaxScalar(p + i, n - i, lo, hi);
+}
+
+#undef MY_CONTAINER_AVX2
+
+#endif // MY_CONTAINER_AGGREGATES_X86
+
+// ---- Dispatch ---------------------------------------------------------------
+
+template<typename T>
+sum_type<T> sumBlock(const T* p, size_t n) {
+#if defined(MY_CONTAINER_AGGREGATES_X86)
+    if constexpr (hasSimdKernels<T>) {
+        switch (activeIsa()) {
+            case Isa::Avx2: return sumAvx2(p, n);
+            case Isa::Sse2: return sumSse2(p, n);
+            case Isa::Scalar: break;
+        }
+    }
+#endif
+    return sumScalar(p, n);
+}
+
+template<typename T>
+void minMaxBlock(const T* p, size_t n, T& lo, T& hi) {
+#if defined(MY_CONTAINER_AGGREGATES_X86)
+    if constexpr (hasSimdKernels<T>) {
+        switch (activeIsa()) {
+            case Isa::Avx2: minMaxAvx2(p, n, lo, hi); return;
+            case Isa::Sse2: minMaxSse2(p, n, lo, hi); return;
+            case Isa::Scalar: break;
+        }
+    }
+#endif
+    minMaxScalar(p, n, lo, hi);
+}
+
+template<typename T>
+double squaredDeviationBlock(const T* p, size_t n, double mean) {
+#if defined(MY_CONTAINER_AGGREGATES_X86)
+    if constexpr (hasSimdKernels<T>) {
+        switch (activeIsa()) {
+            case Isa::Avx2: return squaredDeviationAvx2(p, n, mean);
+            case Isa::Sse2: return squaredDeviationSse2(p, n, mean);
+            case Isa::Scalar: break;
+        }
+    }
+#endif
+    return squaredDeviationScalar(p, n, mean);
+}
+
+template<typename Source>
+using element_t = typename ElementOf<typename std::decay<Source>::type>::type;
+
+template<typename T>
+void requireArithmetic() {
+    static_assert(std::is_arithmetic<T>::value && !std::is_same<T, bool>::value,
+                  "aggregates require an arithmetic element type");
+}
+
+} // namespace detail
+
+/**
+ * @brief Sum of the elements (0 if empty).
+ * @param source A MyContainer, a view, any contiguous or iterable range, span() or gather().
+ */
+template<typename Source>
+sum_type<detail::element_t<Source>> sum(Source&& source) {
+    using T = detail::element_t<Source>;
+    detail::requireArithmetic<T>();
+    sum_type<T> total = 0;
+    detail::forEachBlock(std::forward<Source>(source), [&](const T* p, size_t n) { total += detail::sumBlock(p, n); });
+    return total;
+}
+
+/**
+ * @brief Smallest and largest element. Results for NaN elements are unspecified.
+ * @throws std::runtime_error If the source is empty.
+ */
+template<typename Source>
+std::pair<detail::element_t<Source>, detail::element_t<Source>> minmax(Source&& source) {
+    using T = detail::element_t<Source>;
+    detail::requireArithmetic<T>();
+    bool any = false;
+    T lo{}, hi{};
+    detail::forEachBlock(std::forward<Source>(source), [&](const T* p, size_t n) {
+        if (!any) {
+            lo = hi = p[0];
+            any = true;
+        }
+        detail::minMaxBlock(p, n, lo, hi);
+    });
+    if (!any) throw std::runtime_error("Aggregate of an empty container");
+    return {lo, hi};
+}
+
+/**
+ * @brief Smallest element. Containers with their own min() (MyContainer,
+ *        WindowedMyContainer) answer it themselves, so tracked or cached order is reused.
+ * @throws std::runtime_error If the source is empty.
+ */
+template<typename Source>
+detail::element_t<Source> min(Source&& source) {
+    if constexpr (detail::HasMinMax<typename std::decay<Source>::type>::value) return source.min();
+    else return minmax(std::forward<Source>(source)).first;
+}
+
+/**
+ * @brief Largest element. Containers with their own max() answer it themselves.
+ * @throws std::runtime_error If the source is empty.
+ */
+template<typename Source>
+detail::element_t<Source> max(Source&& source) {
+    if constexpr (detail::HasMinMax<typename std::decay<Source>::type>::value) return source.max();
+    else return minmax(std::forward<Source>(source)).second;
+}
+
+/**
+ * @brief Arithmetic mean.
+ * @throws std::runtime_error If the source is empty.
+ */
+template<typename Source>
+double mean(Source&& source) {
+    using T = detail::element_t<Source>;
+    detail::requireArithmetic<T>();
+    sum_type<T> total = 0;
+    size_t count = 0;
+    detail::forEachBlock(std::forward<Source>(source), [&](const T* p, size_t n) {
+        total += detail::sumBlock(p, n);
+        count += n;
+    });
+    if (count == 0) throw std::runtime_error("Aggregate of an empty container");
+    return static_cast<double>(total) / static_cast<double>(count);
+}
+
+/**
+ * @brief Population variance, computed in two passes (mean, then squared deviations).
+ * @throws std::runtime_error If the source is empty.
+ */
+template<typename Source>
+double variance(Source&& source) {
+    using T = detail::element_t<Source>;
+    const double m = mean(source);
+    double total = 0;
+    size_t count = 0;
+    detail::forEachBlock(std::forward<Source>(source), [&](const T* p, size_t n) {
+        total += detail::squaredDeviationBlock(p, n, m);
+        count += n;
+    });
+    return total / static_cast<double>(count);
+}
+
+} // namespace aggregates
+} // namespace my_container_project
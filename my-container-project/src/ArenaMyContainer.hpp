@@ -0,0 +1,211 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+namespace my_container_project {
+
+/**
+ * @brief String container whose bytes live in large contiguous arena blocks.
+ *
+ * Elements are fixed-size handles (pointer, length and a cached 8-byte
+ * big-endian prefix) into the arena, so adding N strings costs a handful of
+ * block allocations instead of N. Sorted views sort handles and compare the
+ * cached prefixes first; the arena is only read when two prefixes are equal.
+ * Removed strings are not reclaimed from the arena.
+ */
+class ArenaMyContainer {
+public:
+    /// Default size of each arena block; longer strings get a block of their own.
+    static constexpr size_t kDefaultBlockSize = 1 << 20;
+
+private:
+    /**
+     * @brief Fixed-size reference to a string stored in the arena.
+     */
+    struct Handle {
+        uint64_t prefix;   // First 8 bytes, big-endian, zero padded
+        const char* data;
+        size_t length;
+
+        std::string_view view() const { return std::string_view(data, length); }
+
+        bool operator<(const Handle& other) const {
+            if (prefix != other.prefix) return prefix < other.prefix;
+            return view() < other.view();
+        }
+    };
+
+    size_t blockSize;
+    std::vector<std::unique_ptr<char[]>> blocks;
+    size_t blockUsed = 0;     // Bytes used in blocks.back()
+    size_t blockCapacity = 0; // Size of blocks.back()
+    size_t arenaBytes = 0;
+    std::vector<Handle> handles;
+
+    static uint64_t prefixOf(std::string_view s) {
+        uint64_t prefix = 0;
+        size_t n = std::min<size_t>(8, s.size());
+        for (size_t i = 0; i < n; ++i)
+            prefix |= static_cast<uint64_t>(static_cast<unsigned char>(s[i])) << (56 - 8 * i);
+        return prefix;
+    }
+
+    /**
+     * @brief Copies bytes into the arena and returns their stable address.
+     */
+    const char* store(std::string_view s) {
+        if (s.empty()) return "";
+        if (s.size() > blockCapacity - blockUsed) {
+            size_t capacity = std::max(blockSize, s.size());
+            blocks.emplace_back(new char[capacity]);
+            blockCapacity = capacity;
+            blockUsed = 0;
+            arenaBytes += capacity;
+        }
+        char* dst = blocks.back().get() + blockUsed;
+        std::memcpy(dst, s.data(), s.size());
+        blockUsed += s.size();
+        return dst;
+    }
+
+    /**
+     * @brief Iterator over handles yielding std::string_view.
+     */
+    class HandleIterator {
+    private:
+        const Handle* handle;
+    public:
+        explicit HandleIterator(const Handle* h) : handle(h) {}
+
+        std::string_view operator*() const { return handle->view(); }
+
+        HandleIterator& operator++() { ++handle; return *this; } // Prefix increment
+
+        HandleIterator operator++(int) { HandleIterator temp = *this; ++(*this); return temp; } // Postfix increment
+
+        HandleIterator& operator--() { --handle; return *this; } // Prefix decrement
+
+        bool operator!=(const HandleIterator& other) const { return handle != other.handle; }
+
+        bool operator==(const HandleIterator& other) const { return !(*this != other); }
+    };
+
+    /**
+     * @brief View owning its own ordering of the handles.
+     */
+    class HandleView {
+    protected:
+        std::vector<Handle> ordered;
+    public:
+        using Iterator = HandleIterator;
+        Iterator begin() const { return Iterator(ordered.data()); }
+        Iterator end() const { return Iterator(ordered.data() + ordered.size()); }
+    };
+
+public:
+    /**
+     * @brief Constructs an empty container.
+     * @param arenaBlockSize Size of each arena block in bytes.
+     * @throws std::invalid_argument If the block size is zero.
+     */
+    explicit ArenaMyContainer(size_t arenaBlockSize = kDefaultBlockSize) : blockSize(arenaBlockSize) {
+        if (blockSize == 0) throw std::invalid_argument("ArenaMyContainer needs a non-zero block size");
+    }
+
+    /**
+     * @brief Reserves handle storage for n elements.
+     */
+    void reserve(size_t n) { handles.reserve(n); }
+
+    /**
+     * @brief Copies a string into the arena and adds it to the container.
+     * @param element The element to add.
+     */
+    void addElement(std::string_view element) {
+        handles.push_back(Handle{prefixOf(element), store(element), element.size()});
+    }
+
+    /**
+     * @brief Removes all occurrences of an element; arena bytes are not reclaimed.
+     * @param element The element to remove.
+     * @throws std::runtime_error If the element is not found.
+     */
+    void remove(std::string_view element) {
+        uint64_t prefix = prefixOf(element);
+        auto it = std::remove_if(handles.begin(), handles.end(), [&](const Handle& h) {
+            return h.prefix == prefix && h.view() == element;
+        });
+        if (it == handles.end())
+            throw std::runtime_error("Element not found in container");
+        handles.erase(it, handles.end());
+    }
+
+    /**
+     * @brief Returns the number of elements in the container.
+     */
+    size_t size() const { return handles.size(); }
+
+    /**
+     * @brief Returns the element at a position in insertion order.
+     */
+    std::string_view at(size_t i) const { return handles.at(i).view(); }
+
+    /**
+     * @brief Number of arena blocks allocated so far.
+     */
+    size_t blockCount() const { return blocks.size(); }
+
+    /**
+     * @brief Total bytes allocated for arena blocks.
+     */
+    size_t arenaSize() const { return arenaBytes; }
+
+    /**
+     * @brief Original order iterator (in insertion order).
+     */
+    class Order {
+    private:
+        const ArenaMyContainer& owner;
+    public:
+        Order(const ArenaMyContainer& c) : owner(c) {}
+        HandleIterator begin() const { return HandleIterator(owner.handles.data()); }
+        HandleIterator end() const { return HandleIterator(owner.handles.data() + owner.handles.size()); }
+    };
+
+    /**
+     * @brief Reverse order iterator (original insertion order, reversed).
+     */
+    class ReverseOrder : public HandleView {
+    public:
+        ReverseOrder(const ArenaMyContainer& c) { ordered.assign(c.handles.rbegin(), c.handles.rend()); }
+    };
+
+    /**
+     * @brief Ascending order; comparisons use the cached prefix before touching the arena.
+     */
+    class AscendingOrder : public HandleView {
+    public:
+        AscendingOrder(const ArenaMyContainer& c) {
+            ordered = c.handles;
+            std::stable_sort(ordered.begin(), ordered.end());
+        }
+    };
+
+    /**
+     * @brief Descending order; comparisons use the cached prefix before touching the arena.
+     */
+    class DescendingOrder : public HandleView {
+    public:
+        DescendingOrder(const ArenaMyContainer& c) {
+            ordered = c.handles;
+            std::stable_sort(ordered.begin(), ordered.end(), [](const Handle& a, const Handle& b) { return b < a; });
+        }
+    };
+};
+
+} // namespace my_container_project
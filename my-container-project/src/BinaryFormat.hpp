@@ -0,0 +1,359 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace my_container_project {
+namespace binary_format {
+
+/**
+ * @brief Element type tag stored in the file header.
+ * Guards against loading a file written for a different element type.
+ */
+enum class TypeTag : uint8_t {
+    Opaque = 0, // Any other trivially copyable type, checked by size only
+    Char = 1,
+    Bool = 2,
+    Int8 = 3,
+    UInt8 = 4,
+    Int16 = 5,
+    UInt16 = 6,
+    Int32 = 7,
+    UInt32 = 8,
+    Int64 = 9,
+    UInt64 = 10,
+    Float32 = 11,
+    Float64 = 12,
+    LongDouble = 13,
+    String = 14
+};
+
+enum class Endianness : uint8_t { Little = 1, Big = 2 };
+
+constexpr char kMagic[4] = {'M', 'Y', 'C', 'T'};
+constexpr uint16_t kFormatVersion = 2;
+
+/// Header flag: a sorted permutation index section follows the payload (version 2+).
+constexpr uint32_t kHasSortedIndex = 1u << 0;
+
+/**
+ * @brief Fixed 32-byte file header; the payload starts right after it.
+ * The size is a multiple of every scalar alignment so the payload of a
+ * page-aligned mapping is correctly aligned for T.
+ */
+struct FileHeader {
+    char magic[4];
+    uint16_t version;
+    uint8_t endianness;
+    uint8_t typeTag;
+    uint32_t elementSize; // sizeof(T) for raw payloads, 0 for records
+    uint32_t flags;
+    uint64_t count;
+    uint64_t generation; // Mutation generation of the saved container (0 in version 1)
+};
+static_assert(sizeof(FileHeader) == 32, "FileHeader layout must stay 32 bytes");
+
+/**
+ * @brief Byte order of the running machine.
+ */
+inline Endianness nativeEndianness() {
+    const uint16_t probe = 1;
+    unsigned char first;
+    std::memcpy(&first, &probe, 1);
+    return first == 1 ? Endianness::Little : Endianness::Big;
+}
+
+/**
+ * @brief True if T is stored as length-prefixed records rather than raw bytes.
+ */
+template<typename T>
+constexpr bool isRecordType = std::is_same<T, std::string>::value;
+
+template<typename T>
+constexpr bool isSerializable = isRecordType<T> || std::is_trivially_copyable<T>::value;
+
+/**
+ * @brief Returns the header tag describing T.
+ */
+template<typename T>
+constexpr TypeTag typeTagOf() {
+    if constexpr (std::is_same<T, std::string>::value) return TypeTag::String;
+    else if constexpr (std::is_same<T, char>::value) return TypeTag::Char;
+    else if constexpr (std::is_same<T, bool>::value) return TypeTag::Bool;
+    else if constexpr (std::is_integral<T>::value) {
+        constexpr bool s = std::is_signed<T>::value;
+        if constexpr (sizeof(T) == 1) return s ? TypeTag::Int8 : TypeTag::UInt8;
+        else if constexpr (sizeof(T) == 2) return s ? TypeTag::Int16 : TypeTag::UInt16;
+        else if constexpr (sizeof(T) == 4) return s ? TypeTag::Int32 : TypeTag::UInt32;
+        else return s ? TypeTag::Int64 : TypeTag::UInt64;
+    }
+    else if constexpr (std::is_same<T, float>::value) return TypeTag::Float32;
+    else if constexpr (std::is_same<T, double>::value) return TypeTag::Float64;
+    else if constexpr (std::is_same<T, long double>::value) return TypeTag::LongDouble;
+    else return TypeTag::Opaque;
+}
+
+/**
+ * @brief Builds the header for a container of count elements of type T.
+ */
+template<typename T>
+FileHeader makeHeader(uint64_t count, uint64_t generation = 0) {
+    FileHeader h{};
+    std::memcpy(h.magic, kMagic, sizeof(kMagic));
+    h.version = kFormatVersion;
+    h.endianness = static_cast<uint8_t>(nativeEndianness());
+    h.typeTag = static_cast<uint8_t>(typeTagOf<T>());
+    h.elementSize = isRecordType<T> ? 0 : static_cast<uint32_t>(sizeof(T));
+    h.count = count;
+    h.generation = generation;
+    return h;
+}
+
+/**
+ * @brief Validates a header read from path against element type T.
+ * @throws std::runtime_error On any mismatch.
+ */
+template<typename T>
+void validateHeader(const FileHeader& h, const std::string& path) {
+    if (std::memcmp(h.magic, kMagic, sizeof(kMagic)) != 0)
+        throw std::runtime_error("Not a MyContainer binary file: " + path);
+    if (h.version == 0 || h.version > kFormatVersion)
+        throw std::runtime_error("Unsupported MyContainer format version in " + path);
+    if (h.endianness != static_cast<uint8_t>(nativeEndianness()))
+        throw std::runtime_error("Endianness mismatch in " + path);
+    if (h.typeTag != static_cast<uint8_t>(typeTagOf<T>()))
+        throw std::runtime_error("Element type mismatch in " + path);
+    if (h.elementSize != (isRecordType<T> ? 0 : sizeof(T)))
+        throw std::runtime_error("Element size mismatch in " + path);
+}
+
+/**
+ * @brief Appends the binary encoding of a single value to out.
+ * Raw bytes for trivially copyable T, u64 length + bytes for strings.
+ */
+template<typename T>
+void appendValue(std::string& out, const T& value) {
+    static_assert(isSerializable<T>, "MyContainer binary format needs trivially copyable T or std::string");
+    if constexpr (isRecordType<T>) {
+        uint64_t len = value.size();
+        out.append(reinterpret_cast<const char*>(&len), sizeof(len));
+        out.append(value.data(), value.size());
+    } else {
+        out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+}
+
+/**
+ * @brief Decodes one value written by appendValue, advancing p.
+ * @return false if the buffer ends before the value is complete.
+ */
+template<typename T>
+bool readValue(const char*& p, const char* end, T& value) {
+    static_assert(isSerializable<T>, "MyContainer binary format needs trivially copyable T or std::string");
+    if constexpr (isRecordType<T>) {
+        uint64_t len;
+        if (static_cast<size_t>(end - p) < sizeof(len)) return false;
+        std::memcpy(&len, p, sizeof(len));
+        if (static_cast<uint64_t>(end - p) - sizeof(len) < len) return false;
+        p += sizeof(len);
+        value.assign(p, static_cast<size_t>(len));
+        p += len;
+    } else {
+        if (static_cast<size_t>(end - p) < sizeof(T)) return false;
+        std::memcpy(&value, p, sizeof(T));
+        p += sizeof(T);
+    }
+    return true;
+}
+
+/**
+ * @brief Offset of the sorted index section for a payload of payloadBytes.
+ * The section is 8-byte aligned so it can be used in place from a mapping.
+ */
+inline uint64_t sortedIndexOffset(uint64_t payloadBytes) {
+    uint64_t end = sizeof(FileHeader) + payloadBytes;
+    return (end + 7) & ~uint64_t(7);
+}
+
+/**
+ * @brief Writes elements to path as header + payload, optionally followed by
+ *        the sorted permutation index (u64 generation, then one u64 per element).
+ * @param generation Mutation generation of the container being saved.
+ * @param sortedIndex Ascending permutation valid for generation, or nullptr.
+ * @throws std::runtime_error If the file cannot be written.
+ */
+template<typename T, typename Alloc, typename IndexVec = std::vector<size_t>>
+void save(const std::string& path, const std::vector<T, Alloc>& elements,
+          uint64_t generation = 0, const IndexVec* sortedIndex = nullptr) {
+    static_assert(isSerializable<T>, "MyContainer binary format needs trivially copyable T or std::string");
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) throw std::runtime_error("Cannot open file for writing: " + path);
+
+    FileHeader h = makeHeader<T>(elements.size(), generation);
+    if (sortedIndex) h.flags |= kHasSortedIndex;
+    out.write(reinterpret_cast<const char*>(&h), sizeof(h));
+    uint64_t payloadBytes = 0;
+    if constexpr (isRecordType<T>) {
+        std::string buffer;
+        for (const auto& el : elements) {
+            appendValue(buffer, el);
+            if (buffer.size() >= (1u << 20)) {
+                out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+                payloadBytes += buffer.size();
+                buffer.clear();
+            }
+        }
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        payloadBytes += buffer.size();
+    } else if (!elements.empty()) {
+        payloadBytes = elements.size() * sizeof(T);
+        out.write(reinterpret_cast<const char*>(elements.data()), static_cast<std::streamsize>(payloadBytes));
+    }
+
+    if (sortedIndex) {
+        const char padding[8] = {};
+        out.write(padding, static_cast<std::streamsize>(sortedIndexOffset(payloadBytes) - sizeof(h) - payloadBytes));
+        out.write(reinterpret_cast<const char*>(&generation), sizeof(generation));
+        if constexpr (sizeof(typename IndexVec::value_type) == sizeof(uint64_t)) {
+            out.write(reinterpret_cast<const char*>(sortedIndex->data()),
+                      static_cast<std::streamsize>(sortedIndex->size() * sizeof(uint64_t)));
+        } else {
+            for (auto i : *sortedIndex) {
+                uint64_t v = i;
+                out.write(reinterpret_cast<const char*>(&v), sizeof(v));
+            }
+        }
+    }
+    out.flush();
+    if (!out) throw std::runtime_error("Failed writing file: " + path);
+}
+
+/**
+ * @brief Checks that a persisted index is a permutation of [0, count).
+ */
+template<typename It>
+bool isPermutation(It first, It last, uint64_t count) {
+    std::vector<bool> seen(static_cast<size_t>(count), false);
+    for (; first != last; ++first) {
+        uint64_t i = *first;
+        if (i >= count || seen[static_cast<size_t>(i)]) return false;
+        seen[static_cast<size_t>(i)] = true;
+    }
+    return true;
+}
+
+/**
+ * @brief Checks in O(n) that a permutation lists values in stable ascending order,
+ *        i.e. that it is exactly the index getSortedIndex() would build.
+ * The generation stamped on the index section comes from the same save() call as
+ * the header, so it only catches an index spliced in from another file; this
+ * check is what ties a persisted index to the payload it is read with.
+ */
+template<typename Values, typename It>
+bool isSortedPermutation(const Values& values, It first, It last) {
+    if (first == last) return true;
+    for (It next = std::next(first); next != last; first = next++) {
+        const auto& a = values[static_cast<size_t>(*first)];
+        const auto& b = values[static_cast<size_t>(*next)];
+        if (b < a || (!(a < b) && *next < *first)) return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Reads a file written by save() into elements, replacing its contents.
+ * Raw payloads are read with a single read() straight into the vector. If the
+ * file carries a sorted index built for its saved generation that orders the
+ * loaded elements, and sortedIndex is not null, the index is read into it;
+ * otherwise sortedIndex is cleared.
+ * Nothing is modified unless the whole file is valid.
+ * @return The validated file header.
+ * @throws std::runtime_error If the file is missing, truncated or mismatched.
+ */
+template<typename T, typename Alloc, typename IndexVec = std::vector<size_t>>
+FileHeader load(const std::string& path, std::vector<T, Alloc>& elements, IndexVec* sortedIndex = nullptr) {
+    static_assert(isSerializable<T>, "MyContainer binary format needs trivially copyable T or std::string");
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) throw std::runtime_error("Cannot open file for reading: " + path);
+    const uint64_t fileSize = static_cast<uint64_t>(in.tellg());
+    in.seekg(0);
+
+    FileHeader h;
+    if (fileSize < sizeof(h) || !in.read(reinterpret_cast<char*>(&h), sizeof(h)))
+        throw std::runtime_error("Truncated MyContainer file: " + path);
+    validateHeader<T>(h, path);
+    if (h.version < 2) { // Version 1 had no flags and a zero reserved field
+        h.flags = 0;
+        h.generation = 0;
+    }
+    const uint64_t payloadSize = fileSize - sizeof(h);
+
+    std::vector<T, Alloc> loaded(elements.get_allocator());
+    uint64_t payloadBytes = 0;
+    if constexpr (isRecordType<T>) {
+        if (h.count > payloadSize / sizeof(uint64_t))
+            throw std::runtime_error("Truncated MyContainer file: " + path);
+        std::string buffer(static_cast<size_t>(payloadSize), '\0');
+        if (!in.read(&buffer[0], static_cast<std::streamsize>(payloadSize)))
+            throw std::runtime_error("Truncated MyContainer file: " + path);
+        loaded.reserve(static_cast<size_t>(h.count));
+        const char* p = buffer.data();
+        const char* end = p + buffer.size();
+        T value;
+        for (uint64_t i = 0; i < h.count; ++i) {
+            if (!readValue(p, end, value))
+                throw std::runtime_error("Truncated MyContainer file: " + path);
+            loaded.push_back(std::move(value));
+        }
+        payloadBytes = static_cast<uint64_t>(p - buffer.data());
+    } else {
+        if (h.count > payloadSize / sizeof(T))
+            throw std::runtime_error("Truncated MyContainer file: " + path);
+        payloadBytes = h.count * sizeof(T);
+        loaded.resize(static_cast<size_t>(h.count));
+        if (h.count && !in.read(reinterpret_cast<char*>(loaded.data()), static_cast<std::streamsize>(payloadBytes)))
+            throw std::runtime_error("Truncated MyContainer file: " + path);
+    }
+
+    IndexVec index = sortedIndex ? IndexVec(sortedIndex->get_allocator()) : IndexVec();
+    bool haveIndex = false;
+    if ((h.flags & kHasSortedIndex) && sortedIndex) {
+        const uint64_t offset = sortedIndexOffset(payloadBytes);
+        if (offset > fileSize || (fileSize - offset) / sizeof(uint64_t) < h.count + 1)
+            throw std::runtime_error("Truncated sorted index in " + path);
+        in.clear();
+        in.seekg(static_cast<std::streamoff>(offset));
+        uint64_t indexGeneration = 0;
+        in.read(reinterpret_cast<char*>(&indexGeneration), sizeof(indexGeneration));
+        index.resize(static_cast<size_t>(h.count));
+        if constexpr (sizeof(typename IndexVec::value_type) == sizeof(uint64_t)) {
+            in.read(reinterpret_cast<char*>(index.data()), static_cast<std::streamsize>(h.count * sizeof(uint64_t)));
+        } else {
+            for (auto& i : index) {
+                uint64_t v = 0;
+                in.read(reinterpret_cast<char*>(&v), sizeof(v));
+                i = static_cast<typename IndexVec::value_type>(v);
+            }
+        }
+        if (!in) throw std::runtime_error("Truncated sorted index in " + path);
+        if (!isPermutation(index.begin(), index.end(), h.count))
+            throw std::runtime_error("Corrupt sorted index in " + path);
+        haveIndex = indexGeneration == h.generation && isSortedPermutation(loaded, index.begin(), index.end());
+    }
+
+    elements.swap(loaded);
+    if (sortedIndex) {
+        if (haveIndex) sortedIndex->swap(index);
+        else sortedIndex->clear();
+    }
+    if (!haveIndex) h.flags &= ~kHasSortedIndex;
+    return h;
+}
+
+} // namespace binary_format
+} // namespace my_container_project
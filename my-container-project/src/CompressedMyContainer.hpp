@@ -0,0 +1,296 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace my_container_project {
+
+/**
+ * @brief Integer container stored in compressed blocks of 128 values.
+ *
+ * Insertion-order storage uses frame-of-reference encoding: each block keeps
+ * its minimum and bit-packs every value as an offset from it, using only as
+ * many bits as the largest offset needs. The newest (< 128) values stay
+ * uncompressed until their block fills. Order and ReverseOrder decode one
+ * block at a time; AscendingOrder and DescendingOrder keep their sorted copy
+ * delta-encoded (differences between neighbours), which packs tightly
+ * whatever the value range.
+ * @tparam T Integral element type (default: int)
+ */
+template<typename T = int>
+class CompressedMyContainer {
+    static_assert(std::is_integral<T>::value && !std::is_same<T, bool>::value,
+                  "CompressedMyContainer requires an integral element type");
+public:
+    static constexpr size_t kBlockSize = 128;
+
+private:
+    using U = typename std::make_unsigned<T>::type;
+
+    enum class Encoding { FrameOfReference, Delta };
+
+    /**
+     * @brief Sequence of bit-packed blocks sharing one word array.
+     */
+    struct EncodedBlocks {
+        struct Block {
+            T base;             // Minimum (frame of reference) or first value (delta)
+            uint8_t bits;       // Width of each packed value
+            uint64_t firstWord; // Offset of the block's bits in words
+        };
+        std::vector<Block> blocks;
+        std::vector<uint64_t> words;
+
+        static uint8_t bitWidth(U maxValue) {
+            uint8_t bits = 0;
+            while (bits < 64 && (static_cast<uint64_t>(maxValue) >> bits) != 0) ++bits;
+            return bits;
+        }
+
+        /**
+         * @brief Encodes n (<= kBlockSize) values as a new block.
+         */
+        void append(const T* values, size_t n, Encoding encoding) {
+            std::array<U, kBlockSize> packed;
+            T base = values[0];
+            if (encoding == Encoding::FrameOfReference) {
+                base = *std::min_element(values, values + n);
+                for (size_t i = 0; i < n; ++i) packed[i] = static_cast<U>(static_cast<U>(values[i]) - static_cast<U>(base));
+            } else {
+                packed[0] = 0;
+                for (size_t i = 1; i < n; ++i) packed[i] = static_cast<U>(static_cast<U>(values[i]) - static_cast<U>(values[i - 1]));
+            }
+            U maxValue = *std::max_element(packed.begin(), packed.begin() + n);
+            Block block{base, bitWidth(maxValue), words.size()};
+            words.resize(words.size() + (n * block.bits + 63) / 64, 0);
+            uint64_t* out = words.data() + block.firstWord;
+            for (size_t i = 0; i < n && block.bits; ++i) {
+                size_t pos = i * block.bits;
+                size_t shift = pos % 64;
+                uint64_t v = static_cast<uint64_t>(packed[i]);
+                out[pos / 64] |= v << shift;
+                if (shift + block.bits > 64) out[pos / 64 + 1] |= v >> (64 - shift);
+            }
+            blocks.push_back(block);
+        }
+
+        /**
+         * @brief Decodes the n values of block b into out.
+         * The unpack loop has a fixed trip count and no data-dependent branches
+         * so the compiler can vectorize it.
+         */
+        void decode(size_t b, size_t n, Encoding encoding, T* out) const {
+            const Block& block = blocks[b];
+            const uint64_t* in = words.data() + block.firstWord;
+            const unsigned bits = block.bits;
+            const uint64_t mask = bits == 64 ? ~uint64_t(0) : ((uint64_t(1) << bits) - 1);
+            std::array<U, kBlockSize> packed;
+            if (bits == 0) {
+                std::fill(packed.begin(), packed.begin() + n, U(0));
+            } else {
+                for (size_t i = 0; i < n; ++i) {
+                    size_t pos = i * bits;
+                    size_t shift = pos % 64;
+                    uint64_t v = in[pos / 64] >> shift;
+                    uint64_t hi = (shift + bits > 64) ? in[pos / 64 + 1] << (64 - shift) : 0;
+                    packed[i] = static_cast<U>((v | hi) & mask);
+                }
+            }
+            U base = static_cast<U>(block.base);
+            if (encoding == Encoding::FrameOfReference) {
+                for (size_t i = 0; i < n; ++i) out[i] = static_cast<T>(static_cast<U>(base + packed[i]));
+            } else {
+                U running = base;
+                for (size_t i = 0; i < n; ++i) {
+                    running = static_cast<U>(running + packed[i]);
+                    out[i] = static_cast<T>(running);
+                }
+            }
+        }
+
+        size_t bytes() const {
+            return blocks.capacity() * sizeof(Block) + words.capacity() * sizeof(uint64_t);
+        }
+    };
+
+    EncodedBlocks storage;
+    std::vector<T> tail; // Values of the last, not yet full block
+    size_t count = 0;
+
+    /**
+     * @brief Decodes block b of the insertion-order storage (the tail is the last block).
+     * @return Number of values written to out.
+     */
+    size_t decodeStorageBlock(size_t b, T* out) const {
+        if (b == storage.blocks.size()) {
+            std::copy(tail.begin(), tail.end(), out);
+            return tail.size();
+        }
+        storage.decode(b, kBlockSize, Encoding::FrameOfReference, out);
+        return kBlockSize;
+    }
+
+    size_t storageBlockCount() const { return storage.blocks.size() + (tail.empty() ? 0 : 1); }
+
+    /**
+     * @brief Iterator decoding one block at a time, forward or backward.
+     * @tparam Source Provides blockCount() and decodeBlock(b, out) -> size.
+     */
+    template<typename Source>
+    class BlockIterator {
+    private:
+        const Source* source;
+        bool reverse;
+        size_t idx;        // Position in the view
+        size_t block = 0;  // Block currently decoded
+        size_t pos = 0;    // Position inside the decoded block
+        size_t blockLen = 0;
+        std::array<T, kBlockSize> decoded;
+
+        void load(size_t b) {
+            block = b;
+            blockLen = source->decodeBlock(b, decoded.data());
+            pos = reverse ? blockLen - 1 : 0;
+        }
+    public:
+        BlockIterator(const Source* s, bool rev, size_t i, size_t total) : source(s), reverse(rev), idx(i) {
+            if (idx < total) load(reverse ? s->blockCount() - 1 : 0);
+        }
+
+        const T& operator*() const { return decoded[pos]; }
+
+        BlockIterator& operator++() { // Prefix increment
+            ++idx;
+            if (reverse) {
+                if (pos > 0) --pos;
+                else if (block > 0) load(block - 1);
+            } else {
+                if (pos + 1 < blockLen) ++pos;
+                else if (block + 1 < source->blockCount()) load(block + 1);
+            }
+            return *this;
+        }
+
+        bool operator!=(const BlockIterator& other) const { return idx != other.idx || source != other.source; }
+
+        bool operator==(const BlockIterator& other) const { return !(*this != other); }
+    };
+
+    /**
+     * @brief Insertion-order view, forward or backward.
+     */
+    template<bool Reverse>
+    class StorageOrder {
+    private:
+        const CompressedMyContainer& container;
+    public:
+        StorageOrder(const CompressedMyContainer& c) : container(c) {}
+
+        size_t blockCount() const { return container.storageBlockCount(); }
+        size_t decodeBlock(size_t b, T* out) const { return container.decodeStorageBlock(b, out); }
+
+        using Iterator = BlockIterator<StorageOrder>;
+        Iterator begin() const { return Iterator(this, Reverse, 0, container.count); }
+        Iterator end() const { return Iterator(this, Reverse, container.count, container.count); }
+    };
+
+    /**
+     * @brief Sorted view over a delta-encoded sorted copy, ascending or descending.
+     */
+    template<bool Descending>
+    class SortedOrder {
+    private:
+        EncodedBlocks sorted;
+        size_t total;
+    public:
+        /**
+         * @brief Sorts a decoded copy of the container and delta-encodes it.
+         * @param c Source container.
+         */
+        SortedOrder(const CompressedMyContainer& c) : total(c.count) {
+            std::vector<T> values = c.decompress();
+            std::sort(values.begin(), values.end());
+            for (size_t i = 0; i < values.size(); i += kBlockSize)
+                sorted.append(values.data() + i, std::min(kBlockSize, values.size() - i), Encoding::Delta);
+        }
+
+        size_t blockCount() const { return sorted.blocks.size(); }
+        size_t decodeBlock(size_t b, T* out) const {
+            size_t n = std::min(kBlockSize, total - b * kBlockSize);
+            sorted.decode(b, n, Encoding::Delta, out);
+            return n;
+        }
+
+        /**
+         * @brief Bytes used by the compressed sorted copy.
+         */
+        size_t memoryUsage() const { return sorted.bytes(); }
+
+        using Iterator = BlockIterator<SortedOrder>;
+        Iterator begin() const { return Iterator(this, Descending, 0, total); }
+        Iterator end() const { return Iterator(this, Descending, total, total); }
+    };
+
+public:
+    CompressedMyContainer() { tail.reserve(kBlockSize); }
+
+    /**
+     * @brief Adds an element; every kBlockSize elements form a new compressed block.
+     * @param element The element to add.
+     */
+    void addElement(const T& element) {
+        tail.push_back(element);
+        ++count;
+        if (tail.size() == kBlockSize) {
+            storage.append(tail.data(), tail.size(), Encoding::FrameOfReference);
+            tail.clear();
+        }
+    }
+
+    /**
+     * @brief Removes all occurrences of an element and re-encodes the storage.
+     * @param element The element to remove.
+     * @throws std::runtime_error If the element is not found.
+     */
+    void remove(const T& element) {
+        std::vector<T> values = decompress();
+        auto it = std::remove(values.begin(), values.end(), element);
+        if (it == values.end())
+            throw std::runtime_error("Element not found in container");
+        values.erase(it, values.end());
+        storage = EncodedBlocks();
+        tail.clear();
+        count = 0;
+        for (const T& v : values) addElement(v);
+    }
+
+    /**
+     * @brief Returns the number of elements in the container.
+     */
+    size_t size() const { return count; }
+
+    /**
+     * @brief Returns all elements, decoded, in insertion order.
+     */
+    std::vector<T> decompress() const {
+        std::vector<T> values(count);
+        size_t at = 0;
+        for (size_t b = 0; b < storageBlockCount(); ++b) at += decodeStorageBlock(b, values.data() + at);
+        return values;
+    }
+
+    /**
+     * @brief Bytes used by the compressed storage (block headers, packed words and tail).
+     */
+    size_t memoryUsage() const { return storage.bytes() + tail.capacity() * sizeof(T); }
+
+    using Order = StorageOrder<false>;
+    using ReverseOrder = StorageOrder<true>;
+    using AscendingOrder = SortedOrder<false>;
+    using DescendingOrder = SortedOrder<true>;
+};
+
+} // namespace my_container_project
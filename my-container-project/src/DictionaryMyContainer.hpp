@@ -0,0 +1,196 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace my_container_project {
+
+/**
+ * @brief String container that interns values in a dictionary and stores 32-bit codes.
+ *
+ * Each distinct string is stored once; the container and its views hold codes.
+ * Sorted views rank the dictionary once per batch of new distinct values (string
+ * comparisons on distinct values only) and then sort the codes as integers with
+ * a counting sort over the ranks.
+ */
+class DictionaryMyContainer {
+private:
+    std::deque<std::string> dictionary;                     // Code -> value; deque keeps addresses stable
+    std::unordered_map<std::string_view, uint32_t> codeOf;  // Views into dictionary
+    std::vector<uint32_t> codes;                            // Insertion order
+    mutable std::vector<uint32_t> rankOfCode;               // Order-preserving rank per code
+
+    /**
+     * @brief Ranks every dictionary entry by value; only redone when new values appeared.
+     */
+    const std::vector<uint32_t>& ranks() const {
+        if (rankOfCode.size() != dictionary.size()) {
+            std::vector<uint32_t> byValue(dictionary.size());
+            for (uint32_t c = 0; c < byValue.size(); ++c) byValue[c] = c;
+            std::sort(byValue.begin(), byValue.end(),
+                      [this](uint32_t a, uint32_t b) { return dictionary[a] < dictionary[b]; });
+            rankOfCode.resize(dictionary.size());
+            for (uint32_t r = 0; r < byValue.size(); ++r) rankOfCode[byValue[r]] = r;
+        }
+        return rankOfCode;
+    }
+
+    /**
+     * @brief Iterator yielding the dictionary value of each code in a code sequence.
+     */
+    class CodeIterator {
+    private:
+        const DictionaryMyContainer* owner;
+        const uint32_t* code;
+    public:
+        CodeIterator(const DictionaryMyContainer* c, const uint32_t* p) : owner(c), code(p) {}
+
+        const std::string& operator*() const { return owner->dictionary[*code]; }
+
+        CodeIterator& operator++() { ++code; return *this; } // Prefix increment
+
+        CodeIterator operator++(int) { CodeIterator temp = *this; ++(*this); return temp; } // Postfix increment
+
+        CodeIterator& operator--() { --code; return *this; } // Prefix decrement
+
+        bool operator!=(const CodeIterator& other) const { return code != other.code; }
+
+        bool operator==(const CodeIterator& other) const { return !(*this != other); }
+    };
+
+    /**
+     * @brief View owning a code sequence in a particular order.
+     */
+    class CodeView {
+    protected:
+        const DictionaryMyContainer& owner;
+        std::vector<uint32_t> ordered;
+        CodeView(const DictionaryMyContainer& c) : owner(c) {}
+    public:
+        using Iterator = CodeIterator;
+        Iterator begin() const { return Iterator(&owner, ordered.data()); }
+        Iterator end() const { return Iterator(&owner, ordered.data() + ordered.size()); }
+    };
+
+    /**
+     * @brief Returns the codes sorted by value with a counting sort over dictionary ranks.
+     */
+    std::vector<uint32_t> sortedCodes() const {
+        const std::vector<uint32_t>& rank = ranks();
+        std::vector<size_t> start(dictionary.size() + 1, 0);
+        for (uint32_t c : codes) ++start[rank[c] + 1];
+        for (size_t r = 1; r < start.size(); ++r) start[r] += start[r - 1];
+        std::vector<uint32_t> sorted(codes.size());
+        for (uint32_t c : codes) sorted[start[rank[c]]++] = c;
+        return sorted;
+    }
+
+public:
+    DictionaryMyContainer() = default;
+    DictionaryMyContainer(const DictionaryMyContainer&) = delete; // codeOf points into dictionary
+    DictionaryMyContainer& operator=(const DictionaryMyContainer&) = delete;
+    DictionaryMyContainer(DictionaryMyContainer&&) = default; // Moving the deque keeps its elements in place
+    DictionaryMyContainer& operator=(DictionaryMyContainer&&) = default;
+
+    /**
+     * @brief Adds an element, interning it if it has not been seen before.
+     * @param element The element to add.
+     * @throws std::length_error If more than 2^32 distinct values are added.
+     */
+    void addElement(std::string_view element) {
+        auto it = codeOf.find(element);
+        uint32_t code;
+        if (it != codeOf.end()) {
+            code = it->second;
+        } else {
+            if (dictionary.size() == std::numeric_limits<uint32_t>::max())
+                throw std::length_error("Dictionary code space exhausted");
+            code = static_cast<uint32_t>(dictionary.size());
+            dictionary.emplace_back(element);
+            codeOf.emplace(dictionary.back(), code);
+        }
+        codes.push_back(code);
+    }
+
+    /**
+     * @brief Removes all occurrences of an element. Its dictionary entry is kept.
+     * @param element The element to remove.
+     * @throws std::runtime_error If the element is not found.
+     */
+    void remove(std::string_view element) {
+        auto found = codeOf.find(element);
+        auto it = found == codeOf.end() ? codes.end() : std::remove(codes.begin(), codes.end(), found->second);
+        if (it == codes.end())
+            throw std::runtime_error("Element not found in container");
+        codes.erase(it, codes.end());
+    }
+
+    /**
+     * @brief Returns the number of elements in the container.
+     */
+    size_t size() const { return codes.size(); }
+
+    /**
+     * @brief Returns the number of distinct values interned in the dictionary.
+     */
+    size_t distinctCount() const { return dictionary.size(); }
+
+    /**
+     * @brief Returns the dictionary code of each element, in insertion order.
+     */
+    const std::vector<uint32_t>& getCodes() const { return codes; }
+
+    /**
+     * @brief Returns the dictionary value for a code.
+     */
+    const std::string& valueOf(uint32_t code) const { return dictionary.at(code); }
+
+    /**
+     * @brief Original order iterator (in insertion order).
+     */
+    class Order {
+    private:
+        const DictionaryMyContainer& owner;
+    public:
+        Order(const DictionaryMyContainer& c) : owner(c) {}
+        CodeIterator begin() const { return CodeIterator(&owner, owner.codes.data()); }
+        CodeIterator end() const { return CodeIterator(&owner, owner.codes.data() + owner.codes.size()); }
+    };
+
+    /**
+     * @brief Reverse order iterator (original insertion order, reversed).
+     */
+    class ReverseOrder : public CodeView {
+    public:
+        ReverseOrder(const DictionaryMyContainer& c) : CodeView(c) {
+            this->ordered.assign(c.codes.rbegin(), c.codes.rend());
+        }
+    };
+
+    /**
+     * @brief Ascending order, sorting 32-bit codes instead of strings.
+     */
+    class AscendingOrder : public CodeView {
+    public:
+        AscendingOrder(const DictionaryMyContainer& c) : CodeView(c) { this->ordered = c.sortedCodes(); }
+    };
+
+    /**
+     * @brief Descending order, sorting 32-bit codes instead of strings.
+     */
+    class DescendingOrder : public CodeView {
+    public:
+        DescendingOrder(const DictionaryMyContainer& c) : CodeView(c) {
+            this->ordered = c.sortedCodes();
+            std::reverse(this->ordered.begin(), this->ordered.end());
+        }
+    };
+};
+
+} // namespace my_container_project
@@ -0,0 +1,325 @@
+#pragma once
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "BinaryFormat.hpp"
+#include "MyContainer.hpp"
+
+namespace my_container_project {
+
+/**
+ * @brief Group commit and checkpoint settings for the write-ahead log.
+ * With either checkpoint limit set, the operation that reaches it also runs
+ * checkpoint(), so the log stays bounded without the owner's help.
+ * Records are buffered and made durable with one write + fdatasync when either
+ * limit is reached or on sync(). There is no background thread: the limits
+ * are checked on every operation and on poll(), so maxPendingTime bounds how
+ * long a record stays unsynced only if the owner calls poll() at least that
+ * often while the container is idle.
+ */
+struct WalOptions {
+    size_t maxPendingRecords = 256;                       // 1 = fsync every record
+    std::chrono::microseconds maxPendingTime{10000};      // 0 = fsync every record
+    size_t checkpointEveryRecords = 0;                    // Checkpoint after this many logged records (0 = off)
+    uint64_t checkpointLogBytes = 0;                      // Checkpoint once the log reaches this size (0 = off)
+};
+
+/**
+ * @brief MyContainer whose addElement/remove are persisted in an append-only
+ *        write-ahead log, with snapshot checkpoints and crash recovery.
+ *
+ * Log record: u32 payload length, u8 operation, u64 generation after the
+ * operation, the encoded element, u32 checksum. Recovery loads the snapshot,
+ * replays records newer than its generation and truncates a torn tail.
+ * @tparam T Element type supported by the binary format (trivially copyable or std::string)
+ */
+template<typename T = int>
+class DurableMyContainer {
+private:
+    enum class Op : uint8_t { Add = 1, Remove = 2 };
+
+    MyContainer<T> state;
+    std::string snapshotPath;
+    std::string logPath;
+    WalOptions options;
+    int logFd = -1;
+    std::string pending;              // Encoded records not yet written
+    size_t pendingRecords = 0;
+    uint64_t logBytes = 0;            // Size of the committed log on disk
+    size_t logRecords = 0;            // Records in the log, committed or pending
+    std::chrono::steady_clock::time_point oldestPending;
+
+    static uint32_t checksum(const char* data, size_t n) { // FNV-1a
+        uint32_t h = 2166136261u;
+        for (size_t i = 0; i < n; ++i) {
+            h ^= static_cast<unsigned char>(data[i]);
+            h *= 16777619u;
+        }
+        return h;
+    }
+
+    /**
+     * @brief fsyncs the directory containing path, making a rename into it durable.
+     * @throws std::runtime_error On an I/O error.
+     */
+    static void syncDirectoryOf(const std::string& path) {
+        const size_t slash = path.find_last_of('/');
+        const std::string dir = slash == std::string::npos ? "." : slash == 0 ? "/" : path.substr(0, slash);
+        int fd = ::open(dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (fd < 0 || ::fsync(fd) != 0) {
+            if (fd >= 0) ::close(fd);
+            throw std::runtime_error("Failed syncing directory: " + dir);
+        }
+        ::close(fd);
+    }
+
+    static void writeAll(int fd, const char* data, size_t n) {
+        while (n > 0) {
+            ssize_t written = ::write(fd, data, n);
+            if (written < 0) {
+                if (errno == EINTR) continue;
+                throw std::runtime_error(std::string("Failed writing write-ahead log: ") + std::strerror(errno));
+            }
+            data += written;
+            n -= static_cast<size_t>(written);
+        }
+    }
+
+    static bool fileExists(const std::string& path) {
+        struct stat st;
+        return ::stat(path.c_str(), &st) == 0;
+    }
+
+    /**
+     * @brief Encodes one record into the pending buffer and commits if a group limit is hit.
+     * Called before the operation is applied: if the commit fails, the record
+     * is taken back out, so a failed operation is neither applied nor logged.
+     * @param gen Generation the container will have after the operation.
+     */
+    void append(Op op, const T& element, uint64_t gen) {
+        const size_t mark = pending.size();
+        std::string body;
+        body.push_back(static_cast<char>(op));
+        body.append(reinterpret_cast<const char*>(&gen), sizeof(gen));
+        binary_format::appendValue(body, element);
+        uint32_t len = static_cast<uint32_t>(body.size());
+        uint32_t sum = checksum(body.data(), body.size());
+        if (pendingRecords == 0) oldestPending = std::chrono::steady_clock::now();
+        pending.append(reinterpret_cast<const char*>(&len), sizeof(len));
+        pending += body;
+        pending.append(reinterpret_cast<const char*>(&sum), sizeof(sum));
+        ++pendingRecords;
+        if (pendingRecords >= options.maxPendingRecords ||
+            std::chrono::steady_clock::now() - oldestPending >= options.maxPendingTime) {
+            try {
+                sync();
+            } catch (...) {
+                pending.resize(mark);
+                --pendingRecords;
+                throw;
+            }
+        }
+        ++logRecords;
+    }
+
+    /**
+     * @brief Runs checkpoint() if the log has reached a configured limit.
+     */
+    void checkpointIfDue() {
+        if ((options.checkpointEveryRecords != 0 && logRecords >= options.checkpointEveryRecords) ||
+            (options.checkpointLogBytes != 0 && logBytes + pending.size() >= options.checkpointLogBytes))
+            checkpoint();
+    }
+
+    /**
+     * @brief Replays valid log records newer than the snapshot and truncates a torn tail.
+     */
+    void recover() {
+        if (fileExists(snapshotPath)) state.load(snapshotPath);
+
+        std::FILE* f = std::fopen(logPath.c_str(), "rb");
+        if (!f) return;
+        std::string log;
+        char chunk[1 << 16];
+        size_t got;
+        while ((got = std::fread(chunk, 1, sizeof(chunk), f)) > 0) log.append(chunk, got);
+        std::fclose(f);
+
+        size_t valid = 0;
+        const char* p = log.data();
+        const char* end = p + log.size();
+        while (static_cast<size_t>(end - p) >= sizeof(uint32_t)) {
+            uint32_t len, sum;
+            std::memcpy(&len, p, sizeof(len));
+            if (len < 1 + sizeof(uint64_t) || static_cast<size_t>(end - p) < sizeof(len) + len + sizeof(sum)) break;
+            const char* body = p + sizeof(len);
+            std::memcpy(&sum, body + len, sizeof(sum));
+            if (sum != checksum(body, len)) break;
+
+            Op op = static_cast<Op>(body[0]);
+            uint64_t gen;
+            std::memcpy(&gen, body + 1, sizeof(gen));
+            const char* valueBegin = body + 1 + sizeof(gen);
+            T value{};
+            if (!binary_format::readValue(valueBegin, body + len, value) || valueBegin != body + len) break;
+            if (gen > state.getGeneration()) { // Older records are already in the snapshot
+                if (op == Op::Add) state.addElement(value);
+                else if (op == Op::Remove) state.remove(value);
+                else break;
+            }
+            p = body + len + sizeof(sum);
+            valid = static_cast<size_t>(p - log.data());
+            ++logRecords;
+        }
+        if (valid != log.size() && ::truncate(logPath.c_str(), static_cast<off_t>(valid)) != 0)
+            throw std::runtime_error("Cannot truncate torn write-ahead log: " + logPath);
+    }
+
+public:
+    /**
+     * @brief Opens (or creates) a durable container, recovering any previous state.
+     * @param snapshot Path of the checkpoint snapshot (MyContainer binary format).
+     * @param log Path of the write-ahead log.
+     * @param walOptions Group commit settings.
+     * @throws std::runtime_error If the files cannot be read or opened.
+     */
+    DurableMyContainer(std::string snapshot, std::string log, WalOptions walOptions = WalOptions())
+        : snapshotPath(std::move(snapshot)), logPath(std::move(log)), options(walOptions) {
+        recover();
+        logFd = ::open(logPath.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+        if (logFd < 0)
+            throw std::runtime_error("Cannot open write-ahead log: " + logPath + ": " + std::strerror(errno));
+        struct stat st;
+        if (::fstat(logFd, &st) == 0) logBytes = static_cast<uint64_t>(st.st_size);
+    }
+
+    DurableMyContainer(const DurableMyContainer&) = delete;
+    DurableMyContainer& operator=(const DurableMyContainer&) = delete;
+
+    /**
+     * @brief Commits pending records and closes the log.
+     */
+    ~DurableMyContainer() {
+        try {
+            sync();
+        } catch (...) {
+        }
+        if (logFd >= 0) ::close(logFd);
+    }
+
+    /**
+     * @brief Logs an element and adds it; durable after the next group commit.
+     * Runs checkpoint() afterwards if a checkpoint limit is reached.
+     * @param element The element to add.
+     * @throws std::runtime_error On an I/O error (the element is then not added,
+     *         unless only the checkpoint failed).
+     */
+    void addElement(const T& element) {
+        append(Op::Add, element, state.getGeneration() + 1);
+        state.addElement(element);
+        checkpointIfDue();
+    }
+
+    /**
+     * @brief Logs the removal of all occurrences of an element and applies it.
+     * @param element The element to remove.
+     * @throws std::runtime_error If the element is not found (nothing is logged),
+     *         or on an I/O error (the element is then not removed).
+     */
+    void remove(const T& element) {
+        if (!state.contains(element)) throw std::runtime_error("Element not found in container");
+        append(Op::Remove, element, state.getGeneration() + 1);
+        state.remove(element);
+        checkpointIfDue();
+    }
+
+    /**
+     * @brief Writes all pending records with one write() and one fdatasync().
+     * @throws std::runtime_error On an I/O error.
+     */
+    void sync() {
+        if (pendingRecords == 0) return;
+        try {
+            writeAll(logFd, pending.data(), pending.size());
+            if (::fdatasync(logFd) != 0)
+                throw std::runtime_error(std::string("Failed syncing write-ahead log: ") + std::strerror(errno));
+        } catch (...) {
+            // Cut off any part of the group that reached the file; the records stay pending
+            if (::ftruncate(logFd, static_cast<off_t>(logBytes)) != 0) {
+            }
+            throw;
+        }
+        logBytes += pending.size();
+        pending.clear();
+        pendingRecords = 0;
+    }
+
+    /**
+     * @brief Commits the pending records if the oldest has waited maxPendingTime.
+     * Call periodically (from an event loop or timer) so that records logged
+     * just before the container goes idle still become durable in time.
+     * @return True if a commit happened.
+     * @throws std::runtime_error On an I/O error.
+     */
+    bool poll() {
+        if (pendingRecords == 0 || std::chrono::steady_clock::now() - oldestPending < options.maxPendingTime)
+            return false;
+        sync();
+        return true;
+    }
+
+    /**
+     * @brief Writes a snapshot of the current state and truncates the log.
+     * The snapshot is written to a temporary file and renamed into place, so a
+     * crash at any point leaves a recoverable snapshot + log pair.
+     * @throws std::runtime_error On an I/O error.
+     */
+    void checkpoint() {
+        sync();
+        const std::string tmp = snapshotPath + ".tmp";
+        state.save(tmp);
+        int fd = ::open(tmp.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0 || ::fsync(fd) != 0) {
+            if (fd >= 0) ::close(fd);
+            throw std::runtime_error("Failed syncing snapshot: " + tmp);
+        }
+        ::close(fd);
+        if (std::rename(tmp.c_str(), snapshotPath.c_str()) != 0)
+            throw std::runtime_error("Failed installing snapshot: " + snapshotPath);
+        // The rename must be durable before the log is truncated: otherwise a
+        // crash could keep the truncation but not the rename, and recovery
+        // would pair the old snapshot with an empty log.
+        syncDirectoryOf(snapshotPath);
+        if (::ftruncate(logFd, 0) != 0 || ::fdatasync(logFd) != 0)
+            throw std::runtime_error("Failed truncating write-ahead log: " + logPath);
+        logBytes = 0;
+        logRecords = 0;
+    }
+
+    /**
+     * @brief Number of logged operations not yet made durable.
+     */
+    size_t pendingCount() const { return pendingRecords; }
+
+    /**
+     * @brief Returns the number of elements in the container.
+     */
+    size_t size() const { return state.size(); }
+
+    /**
+     * @brief Read-only access to the recovered in-memory state.
+     */
+    const MyContainer<T>& container() const { return state; }
+};
+
+} // namespace my_container_project
@@ -0,0 +1,369 @@
+#pragma once
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <unistd.h>
+
+namespace my_container_project {
+
+/**
+ * @brief Out-of-core container whose sorted views stream a k-way merge of
+ *        sorted runs spilled to temporary files.
+ *
+ * Elements are buffered in memory until the memory budget is reached; the
+ * buffer is then sorted and written as one run. AscendingOrder and
+ * DescendingOrder merge all runs through fixed-size read blocks, so memory use
+ * stays bounded by the budget and all I/O is sequential (forward for ascending,
+ * block-wise backward for descending). When there are more runs than fit in the
+ * budget, they are first merged into larger runs in extra passes.
+ * @tparam T Trivially copyable element type (default: int)
+ */
+template<typename T = int>
+class ExternalMyContainer {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "ExternalMyContainer spills raw bytes and requires a trivially copyable element type");
+private:
+    struct FileCloser {
+        void operator()(std::FILE* f) const { std::fclose(f); }
+    };
+
+    /**
+     * @brief One sorted run stored in an anonymous (already unlinked) temporary file.
+     */
+    struct Run {
+        std::unique_ptr<std::FILE, FileCloser> file;
+        size_t count = 0;
+    };
+
+    /**
+     * @brief Reads a run block by block, forward or backward, with pread().
+     */
+    class RunReader {
+    private:
+        int fd;
+        size_t remaining;   // Elements not yet loaded from the file
+        size_t nextForward = 0;
+        bool backward;
+        std::vector<T> block;
+        size_t pos = 0;     // Next element of block to return
+    public:
+        RunReader(const Run& run, size_t blockElements, bool readBackward)
+            : fd(fileno(run.file.get())), remaining(run.count), backward(readBackward) {
+            block.reserve(blockElements);
+            fill(blockElements);
+        }
+
+        bool empty() const { return pos == block.size(); }
+
+        const T& current() const { return block[pos]; }
+
+        void advance(size_t blockElements) {
+            if (++pos == block.size()) fill(blockElements);
+        }
+
+    private:
+        void fill(size_t blockElements) {
+            size_t n = std::min(blockElements, remaining);
+            block.resize(n);
+            pos = 0;
+            if (n == 0) return;
+            size_t first = backward ? remaining - n : nextForward;
+            readAt(block.data(), n, first);
+            if (backward) std::reverse(block.begin(), block.end());
+            else nextForward += n;
+            remaining -= n;
+        }
+
+        void readAt(T* dst, size_t n, size_t firstElement) {
+            char* out = reinterpret_cast<char*>(dst);
+            size_t bytes = n * sizeof(T);
+            off_t offset = static_cast<off_t>(firstElement * sizeof(T));
+            while (bytes > 0) {
+                ssize_t got = ::pread(fd, out, bytes, offset);
+                if (got < 0 && errno == EINTR) continue;
+                if (got <= 0) throw std::runtime_error("Failed reading spilled run");
+                out += got;
+                offset += got;
+                bytes -= static_cast<size_t>(got);
+            }
+        }
+    };
+
+    size_t memoryBudget;   // Maximum number of elements held in memory
+    size_t blockElements;  // Elements per read block of a run during merges
+    std::string tempDir;   // Spill directory, never empty
+    std::vector<T> buffer; // Elements not yet spilled
+    bool bufferSorted = true;
+    std::vector<Run> runs;
+    size_t total = 0;
+    size_t peakMemory = 0; // Most elements held at once: buffer or merge blocks
+
+    void noteMemory(size_t elements) { peakMemory = std::max(peakMemory, elements); }
+
+    Run createRun() const {
+        std::FILE* f = nullptr;
+        std::string pattern = tempDir + "/mycontainer-run-XXXXXX";
+        int fd = ::mkstemp(&pattern[0]);
+        if (fd >= 0) {
+            ::unlink(pattern.c_str());
+            f = ::fdopen(fd, "w+b");
+            if (!f) ::close(fd);
+        }
+        if (!f) throw std::runtime_error(std::string("Cannot create spill file: ") + std::strerror(errno));
+        Run run;
+        run.file.reset(f);
+        return run;
+    }
+
+    /**
+     * @brief The spill directory to use: the given one, else $TMPDIR, else /tmp.
+     */
+    static std::string resolveTempDir(std::string dir) {
+        if (!dir.empty()) return dir;
+        const char* env = std::getenv("TMPDIR");
+        return env && *env ? std::string(env) : std::string("/tmp");
+    }
+
+    static void appendToRun(Run& run, const T* data, size_t n) {
+        if (n && std::fwrite(data, sizeof(T), n, run.file.get()) != n)
+            throw std::runtime_error("Failed writing spilled run");
+        run.count += n;
+    }
+
+    static void finishRun(Run& run) {
+        if (std::fflush(run.file.get()) != 0) throw std::runtime_error("Failed writing spilled run");
+    }
+
+    /**
+     * @brief Sorts the in-memory buffer and writes it out as a new run.
+     */
+    void spill() {
+        if (buffer.empty()) return;
+        std::sort(buffer.begin(), buffer.end());
+        Run run = createRun();
+        appendToRun(run, buffer.data(), buffer.size());
+        finishRun(run);
+        runs.push_back(std::move(run));
+        buffer.clear();
+    }
+
+    /**
+     * @brief Number of runs that can be merged at once within `available`
+     *        elements of the budget, keeping one block for the merged output.
+     */
+    size_t fanIn(size_t available) const { return std::max<size_t>(2, available / blockElements - 1); }
+
+    /**
+     * @brief Streaming k-way merge over a set of runs and, optionally, one
+     *        sorted in-memory range (source index readers.size()).
+     */
+    class Merger {
+    private:
+        struct Greater { // Min-heap on value
+            bool operator()(const std::pair<T, size_t>& a, const std::pair<T, size_t>& b) const { return b.first < a.first; }
+        };
+        struct Less { // Max-heap on value
+            bool operator()(const std::pair<T, size_t>& a, const std::pair<T, size_t>& b) const { return a.first < b.first; }
+        };
+        using MinHeap = std::priority_queue<std::pair<T, size_t>, std::vector<std::pair<T, size_t>>, Greater>;
+        using MaxHeap = std::priority_queue<std::pair<T, size_t>, std::vector<std::pair<T, size_t>>, Less>;
+
+        std::vector<RunReader> readers;
+        const T* memory = nullptr;
+        size_t memorySize = 0;
+        size_t memoryPos = 0;
+        MinHeap minHeap;
+        MaxHeap maxHeap;
+        bool descending;
+        size_t blockElements;
+
+        void push(size_t r) {
+            const T* value;
+            if (r == readers.size()) {
+                if (memoryPos == memorySize) return;
+                value = &memory[descending ? memorySize - 1 - memoryPos : memoryPos];
+            } else {
+                if (readers[r].empty()) return;
+                value = &readers[r].current();
+            }
+            if (descending) maxHeap.emplace(*value, r);
+            else minHeap.emplace(*value, r);
+        }
+    public:
+        Merger(const std::vector<Run>& runs, size_t first, size_t last, size_t block, bool desc,
+               const std::vector<T>* sortedMemory = nullptr)
+            : descending(desc), blockElements(block) {
+            readers.reserve(last - first);
+            for (size_t i = first; i < last; ++i) readers.emplace_back(runs[i], block, desc);
+            if (sortedMemory) {
+                memory = sortedMemory->data();
+                memorySize = sortedMemory->size();
+            }
+            for (size_t r = 0; r <= readers.size(); ++r) push(r);
+        }
+
+        bool done() const { return descending ? maxHeap.empty() : minHeap.empty(); }
+
+        const T& current() const { return descending ? maxHeap.top().first : minHeap.top().first; }
+
+        void advance() {
+            size_t r = descending ? maxHeap.top().second : minHeap.top().second;
+            if (descending) maxHeap.pop();
+            else minHeap.pop();
+            if (r == readers.size()) ++memoryPos;
+            else readers[r].advance(blockElements);
+            push(r);
+        }
+    };
+
+    /**
+     * @brief Prepares a view: sorts the buffer in place so it joins the merge
+     *        as an extra source, then merges runs until at most fanIn() remain.
+     * The buffer is spilled instead only if it leaves less than three blocks
+     * of the budget for merging, so views never create tiny runs.
+     */
+    void prepareMerge() {
+        if (buffer.size() + 3 * blockElements > memoryBudget) {
+            spill();
+        } else if (!bufferSorted) {
+            std::sort(buffer.begin(), buffer.end());
+            bufferSorted = true;
+        }
+        const size_t ways = fanIn(memoryBudget - buffer.size());
+        while (runs.size() > ways) {
+            std::vector<Run> merged;
+            for (size_t first = 0; first < runs.size(); first += ways) {
+                size_t last = std::min(runs.size(), first + ways);
+                if (last - first == 1) {
+                    merged.push_back(std::move(runs[first]));
+                    continue;
+                }
+                noteMemory(buffer.size() + (last - first + 1) * blockElements);
+                Run out = createRun();
+                std::vector<T> pending;
+                pending.reserve(blockElements);
+                for (Merger m(runs, first, last, blockElements, false); !m.done(); m.advance()) {
+                    pending.push_back(m.current());
+                    if (pending.size() == blockElements) {
+                        appendToRun(out, pending.data(), pending.size());
+                        pending.clear();
+                    }
+                }
+                appendToRun(out, pending.data(), pending.size());
+                finishRun(out);
+                merged.push_back(std::move(out));
+            }
+            runs = std::move(merged);
+        }
+    }
+
+    /**
+     * @brief Sorted view streaming the merge of all runs.
+     * @tparam Descending Iterate from largest to smallest instead.
+     */
+    template<bool Descending>
+    class MergedOrder {
+    private:
+        ExternalMyContainer& container;
+        std::unique_ptr<Merger> merger;
+    public:
+        /**
+         * @brief Constructs the view; buffered elements are merged from memory.
+         * @param container Source container.
+         */
+        MergedOrder(ExternalMyContainer& c) : container(c) { container.prepareMerge(); }
+
+        /**
+         * @brief Single-pass input iterator over the merged runs.
+         */
+        class Iterator {
+        private:
+            MergedOrder* view;
+            size_t idx;
+        public:
+            Iterator(MergedOrder* v, size_t i) : view(v), idx(i) {}
+
+            const T& operator*() const { return view->merger->current(); }
+
+            Iterator& operator++() { view->merger->advance(); ++idx; return *this; } // Prefix increment
+
+            bool operator!=(const Iterator& other) const { return idx != other.idx || view != other.view; }
+
+            bool operator==(const Iterator& other) const { return !(*this != other); }
+        };
+
+        /**
+         * @brief Starts (or restarts) the merge from the beginning.
+         */
+        Iterator begin() {
+            container.noteMemory(container.buffer.size() + container.runs.size() * container.blockElements);
+            merger.reset(new Merger(container.runs, 0, container.runs.size(), container.blockElements, Descending,
+                                    &container.buffer));
+            return Iterator(this, 0);
+        }
+        Iterator end() { return Iterator(this, container.total); }
+    };
+
+public:
+    /**
+     * @brief Constructs an empty container.
+     * @param memoryBudgetElements Maximum number of elements kept in memory.
+     * @param readBlockElements Elements per read block of a run while merging
+     *        (at most a third of the budget, so two inputs and an output fit).
+     * @param tempDirectory Directory for spill files (empty: $TMPDIR, or /tmp if unset).
+     * @throws std::invalid_argument If the budget or block size is zero.
+     */
+    explicit ExternalMyContainer(size_t memoryBudgetElements, size_t readBlockElements = 4096,
+                                 std::string tempDirectory = std::string())
+        : memoryBudget(memoryBudgetElements),
+          blockElements(std::min(readBlockElements, memoryBudgetElements / 3 ? memoryBudgetElements / 3 : 1)),
+          tempDir(resolveTempDir(std::move(tempDirectory))) {
+        if (memoryBudgetElements == 0 || readBlockElements == 0)
+            throw std::invalid_argument("ExternalMyContainer needs a non-zero memory budget and block size");
+    }
+
+    /**
+     * @brief Adds an element, spilling a sorted run when the memory budget is reached.
+     * @param element The element to add.
+     * @throws std::runtime_error If a spill file cannot be written.
+     */
+    void addElement(const T& element) {
+        buffer.push_back(element);
+        bufferSorted = false;
+        ++total;
+        noteMemory(buffer.size());
+        if (buffer.size() >= memoryBudget) spill();
+    }
+
+    /**
+     * @brief Returns the number of elements in the container.
+     */
+    size_t size() const { return total; }
+
+    /**
+     * @brief Returns the number of sorted runs currently on disk.
+     */
+    size_t runCount() const { return runs.size(); }
+
+    /**
+     * @brief Most elements held in memory at once so far, counting the buffer
+     *        and every read and write block of a merge; at most the budget
+     *        whenever the budget holds three blocks.
+     */
+    size_t peakMemoryElements() const { return peakMemory; }
+
+    using AscendingOrder = MergedOrder<false>;
+    using DescendingOrder = MergedOrder<true>;
+};
+
+} // namespace my_container_project
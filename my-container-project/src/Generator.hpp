@@ -0,0 +1,117 @@
+#pragma once
+#if defined(__cpp_impl_coroutine)
+#include <coroutine>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace my_container_project {
+
+/**
+ * @brief Minimal lazy generator yielding references produced by a coroutine.
+ *
+ * Elements are produced on demand: the coroutine is resumed once per increment
+ * and the yielded reference stays valid until the next increment.
+ * @tparam Ref Reference type yielded (e.g. const T&).
+ */
+template<typename Ref>
+class Generator {
+public:
+    using value_type = std::remove_cv_t<std::remove_reference_t<Ref>>;
+    using pointer = std::add_pointer_t<Ref>;
+
+    class promise_type {
+    private:
+        pointer current = nullptr;
+        std::exception_ptr error;
+        friend class Generator;
+    public:
+        Generator get_return_object() noexcept {
+            return Generator(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        std::suspend_always initial_suspend() const noexcept { return {}; }
+        std::suspend_always final_suspend() const noexcept { return {}; }
+        std::suspend_always yield_value(Ref value) noexcept {
+            current = std::addressof(value);
+            return {};
+        }
+        void return_void() const noexcept {}
+        void unhandled_exception() { error = std::current_exception(); }
+    };
+
+    using handle_type = std::coroutine_handle<promise_type>;
+
+    /**
+     * @brief Single-pass input iterator over the generated sequence.
+     */
+    class Iterator {
+    private:
+        handle_type coro;
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = Generator::value_type;
+        using difference_type = std::ptrdiff_t;
+
+        Iterator() = default;
+        explicit Iterator(handle_type h) : coro(h) {}
+
+        Ref operator*() const { return static_cast<Ref>(*coro.promise().current); }
+
+        Iterator& operator++() { // Prefix increment
+            coro.resume();
+            if (coro.done()) Generator::rethrowIfFailed(coro);
+            return *this;
+        }
+
+        void operator++(int) { ++(*this); } // Postfix increment
+
+        bool operator==(std::default_sentinel_t) const { return !coro || coro.done(); }
+
+        bool operator!=(std::default_sentinel_t s) const { return !(*this == s); }
+    };
+
+    Generator(Generator&& other) noexcept : coro(std::exchange(other.coro, {})) {}
+
+    Generator& operator=(Generator&& other) noexcept {
+        if (this != &other) {
+            if (coro) coro.destroy();
+            coro = std::exchange(other.coro, {});
+        }
+        return *this;
+    }
+
+    Generator(const Generator&) = delete;
+    Generator& operator=(const Generator&) = delete;
+
+    ~Generator() {
+        if (coro) coro.destroy();
+    }
+
+    /**
+     * @brief Starts the coroutine and returns an iterator to the first element.
+     * May only be called once per generator.
+     */
+    Iterator begin() {
+        if (coro) {
+            coro.resume();
+            if (coro.done()) rethrowIfFailed(coro);
+        }
+        return Iterator(coro);
+    }
+
+    std::default_sentinel_t end() const noexcept { return {}; }
+
+private:
+    handle_type coro;
+
+    explicit Generator(handle_type h) noexcept : coro(h) {}
+
+    static void rethrowIfFailed(handle_type h) {
+        if (h.promise().error) std::rethrow_exception(h.promise().error);
+    }
+};
+
+} // namespace my_container_project
+#endif // __cpp_impl_coroutine
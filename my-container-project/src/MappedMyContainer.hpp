@@ -0,0 +1,355 @@
+#pragma once
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "BinaryFormat.hpp"
+
+namespace my_container_project {
+
+/**
+ * @brief Read-only container backed by a memory-mapped file written by MyContainer::save().
+ *
+ * Opening is O(1) regardless of size: elements are read directly from the mapped
+ * pages, which several processes can share through the page cache. Sorted views
+ * use the index persisted by save(path, true) when present, and otherwise build a
+ * permutation index in process memory on first use.
+ * @tparam T Trivially copyable element type (default: int)
+ */
+template<typename T = int>
+class MappedMyContainer {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "MappedMyContainer requires a trivially copyable element type");
+private:
+    void* mapping = nullptr;
+    size_t mappingSize = 0;
+    const T* values = nullptr;
+    size_t count = 0;
+    uint64_t generation = 0;
+    mutable const uint64_t* persistedIndex = nullptr; // Sorted index stored in the file, if any
+    mutable bool persistedIndexChecked = false;
+    mutable std::vector<size_t> sortedIndex; // Built lazily by sorted views
+    mutable bool sortedIndexBuilt = false;
+
+    void unmap() {
+        if (mapping) munmap(mapping, mappingSize);
+        mapping = nullptr;
+        mappingSize = 0;
+        values = nullptr;
+        count = 0;
+        generation = 0;
+        persistedIndex = nullptr;
+        persistedIndexChecked = false;
+    }
+
+    /**
+     * @brief Validates the persisted index once: it must be a permutation, and it
+     *        is dropped (views then sort in memory) if it does not order the values.
+     * @throws std::runtime_error If the persisted index is not a permutation.
+     */
+    void checkPersistedIndex() const {
+        if (!persistedIndex || persistedIndexChecked) return;
+        if (!binary_format::isPermutation(persistedIndex, persistedIndex + count, count))
+            throw std::runtime_error("Corrupt sorted index in mapped file");
+        if (!binary_format::isSortedPermutation(values, persistedIndex, persistedIndex + count))
+            persistedIndex = nullptr;
+        persistedIndexChecked = true;
+    }
+
+    /**
+     * @brief Makes the ascending permutation available to the sorted views.
+     * Uses the index persisted in the file when present (validated once, no
+     * sorting); otherwise builds it on first use.
+     * @throws std::runtime_error If the persisted index is corrupt.
+     */
+    void ensureSortedIndex() const {
+        checkPersistedIndex();
+        if (persistedIndex) return;
+        if (!sortedIndexBuilt) {
+            sortedIndex.resize(count);
+            for (size_t i = 0; i < count; ++i) sortedIndex[i] = i;
+            const T* v = values;
+            std::stable_sort(sortedIndex.begin(), sortedIndex.end(),
+                             [v](size_t a, size_t b) { return v[a] < v[b]; });
+            sortedIndexBuilt = true;
+        }
+    }
+
+    /**
+     * @brief Position of the element with the given ascending rank.
+     */
+    size_t positionOfRank(size_t rank) const {
+        return persistedIndex ? static_cast<size_t>(persistedIndex[rank]) : sortedIndex[rank];
+    }
+
+    /**
+     * @brief Random-access iterator mapping a view position to an element.
+     * @tparam View Class providing static const T& at(const MappedMyContainer&, size_t).
+     */
+    template<typename View>
+    class PositionIterator {
+    private:
+        const MappedMyContainer* owner;
+        size_t idx;
+    public:
+        PositionIterator(const MappedMyContainer* c, size_t i) : owner(c), idx(i) {}
+
+        const T& operator*() const { return View::at(*owner, idx); }
+
+        PositionIterator& operator++() { ++idx; return *this; } // Prefix increment
+
+        PositionIterator operator++(int) { PositionIterator temp = *this; ++(*this); return temp; } // Postfix increment
+
+        PositionIterator& operator--() { --idx; return *this; } // Prefix decrement
+
+        PositionIterator operator--(int) { PositionIterator temp = *this; --(*this); return temp; } // Postfix decrement
+
+        PositionIterator operator+(size_t n) const { return PositionIterator(owner, idx + n); } // Advance by n
+
+        PositionIterator operator-(size_t n) const { return PositionIterator(owner, idx - n); } // Retreat by n
+
+        const T& operator[](size_t n) const { return View::at(*owner, idx + n); } // Access by index
+
+        bool operator!=(const PositionIterator& other) const { return idx != other.idx || owner != other.owner; }
+
+        bool operator==(const PositionIterator& other) const { return !(*this != other); }
+    };
+
+    /**
+     * @brief Points persistedIndex into the mapping if the file's index matches its generation.
+     */
+    void mapPersistedIndex(const binary_format::FileHeader& h, const std::string& path) {
+        const uint64_t offset = binary_format::sortedIndexOffset(h.count * sizeof(T));
+        if (offset > mappingSize || (mappingSize - offset) / sizeof(uint64_t) < h.count + 1)
+            throw std::runtime_error("Truncated sorted index in " + path);
+        const uint64_t* section = reinterpret_cast<const uint64_t*>(static_cast<const char*>(mapping) + offset);
+        if (section[0] == h.generation) persistedIndex = section + 1;
+    }
+
+public:
+    /**
+     * @brief Maps a file written by MyContainer<T>::save().
+     * @param path Source file.
+     * @throws std::runtime_error If the file cannot be mapped or holds another type.
+     */
+    explicit MappedMyContainer(const std::string& path) {
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+            throw std::runtime_error("Cannot open file for mapping: " + path + ": " + std::strerror(errno));
+        struct stat st;
+        if (::fstat(fd, &st) != 0) {
+            int err = errno;
+            ::close(fd);
+            throw std::runtime_error("Cannot stat file: " + path + ": " + std::strerror(err));
+        }
+        mappingSize = static_cast<size_t>(st.st_size);
+        if (mappingSize < sizeof(binary_format::FileHeader)) {
+            ::close(fd);
+            throw std::runtime_error("Truncated MyContainer file: " + path);
+        }
+        void* p = ::mmap(nullptr, mappingSize, PROT_READ, MAP_SHARED, fd, 0);
+        int err = errno;
+        ::close(fd);
+        if (p == MAP_FAILED)
+            throw std::runtime_error("Cannot map file: " + path + ": " + std::strerror(err));
+        mapping = p;
+
+        try {
+            binary_format::FileHeader h;
+            std::memcpy(&h, mapping, sizeof(h));
+            binary_format::validateHeader<T>(h, path);
+            if (h.count > (mappingSize - sizeof(h)) / sizeof(T))
+                throw std::runtime_error("Truncated MyContainer file: " + path);
+            values = reinterpret_cast<const T*>(static_cast<const char*>(mapping) + sizeof(h));
+            count = static_cast<size_t>(h.count);
+            if (h.version >= 2) {
+                generation = h.generation;
+                if (h.flags & binary_format::kHasSortedIndex)
+                    mapPersistedIndex(h, path);
+            }
+        } catch (...) {
+            unmap();
+            throw;
+        }
+    }
+
+    MappedMyContainer(MappedMyContainer&& other) noexcept
+        : mapping(std::exchange(other.mapping, nullptr)),
+          mappingSize(std::exchange(other.mappingSize, 0)),
+          values(std::exchange(other.values, nullptr)),
+          count(std::exchange(other.count, 0)),
+          generation(std::exchange(other.generation, 0)),
+          persistedIndex(std::exchange(other.persistedIndex, nullptr)),
+          persistedIndexChecked(std::exchange(other.persistedIndexChecked, false)),
+          sortedIndex(std::move(other.sortedIndex)),
+          sortedIndexBuilt(std::exchange(other.sortedIndexBuilt, false)) {}
+
+    MappedMyContainer& operator=(MappedMyContainer&& other) noexcept {
+        if (this != &other) {
+            unmap();
+            mapping = std::exchange(other.mapping, nullptr);
+            mappingSize = std::exchange(other.mappingSize, 0);
+            values = std::exchange(other.values, nullptr);
+            count = std::exchange(other.count, 0);
+            generation = std::exchange(other.generation, 0);
+            persistedIndex = std::exchange(other.persistedIndex, nullptr);
+            persistedIndexChecked = std::exchange(other.persistedIndexChecked, false);
+            sortedIndex = std::move(other.sortedIndex);
+            sortedIndexBuilt = std::exchange(other.sortedIndexBuilt, false);
+        }
+        return *this;
+    }
+
+    MappedMyContainer(const MappedMyContainer&) = delete;
+    MappedMyContainer& operator=(const MappedMyContainer&) = delete;
+
+    ~MappedMyContainer() { unmap(); }
+
+    /**
+     * @brief Returns the number of elements in the mapped file.
+     */
+    size_t size() const { return count; }
+
+    /**
+     * @brief Pointer to the first element inside the mapping.
+     */
+    const T* data() const { return values; }
+
+    const T& operator[](size_t i) const { return values[i]; }
+
+    /**
+     * @brief Mutation generation the file was saved at.
+     */
+    uint64_t getGeneration() const { return generation; }
+
+    /**
+     * @brief True if sorted views use an index persisted in the file (no sorting needed).
+     * The first call validates the index in O(n).
+     * @throws std::runtime_error If the persisted index is not a permutation.
+     */
+    bool hasPersistedSortedIndex() const {
+        checkPersistedIndex();
+        return persistedIndex != nullptr;
+    }
+
+    /**
+     * @brief Original order view over the mapped pages.
+     */
+    class Order {
+    private:
+        const MappedMyContainer& owner;
+    public:
+        Order(const MappedMyContainer& container) : owner(container) {}
+
+        static const T& at(const MappedMyContainer& c, size_t i) { return c.values[i]; }
+
+        using Iterator = PositionIterator<Order>;
+        Iterator begin() const { return Iterator(&owner, 0); }
+        Iterator end() const { return Iterator(&owner, owner.count); }
+    };
+
+    /**
+     * @brief Reverse insertion order view over the mapped pages.
+     */
+    class ReverseOrder {
+    private:
+        const MappedMyContainer& owner;
+    public:
+        ReverseOrder(const MappedMyContainer& container) : owner(container) {}
+
+        static const T& at(const MappedMyContainer& c, size_t i) { return c.values[c.count - 1 - i]; }
+
+        using Iterator = PositionIterator<ReverseOrder>;
+        Iterator begin() const { return Iterator(&owner, 0); }
+        Iterator end() const { return Iterator(&owner, owner.count); }
+    };
+
+    /**
+     * @brief Middle-out order view; positions are computed without a buffer.
+     * Uses the same middle index rule as MyContainer::MiddleOutOrder.
+     */
+    class MiddleOutOrder {
+    private:
+        const MappedMyContainer& owner;
+    public:
+        MiddleOutOrder(const MappedMyContainer& container) : owner(container) {}
+
+        static const T& at(const MappedMyContainer& c, size_t k) {
+            size_t n = c.count;
+            size_t mid = (n % 2 == 0) ? (n / 2 - 1) : (n / 2);
+            if (k == 0) return c.values[mid];
+            if (k <= 2 * mid) // Left and right alternate while both sides remain
+                return (k % 2 == 1) ? c.values[mid - (k + 1) / 2] : c.values[mid + k / 2];
+            return c.values[mid + (k - mid)];
+        }
+
+        using Iterator = PositionIterator<MiddleOutOrder>;
+        Iterator begin() const { return Iterator(&owner, 0); }
+        Iterator end() const { return Iterator(&owner, owner.count); }
+    };
+
+    /**
+     * @brief Ascending order view through the permutation index.
+     */
+    class AscendingOrder {
+    private:
+        const MappedMyContainer& owner;
+    public:
+        AscendingOrder(const MappedMyContainer& container) : owner(container) { owner.ensureSortedIndex(); }
+
+        static const T& at(const MappedMyContainer& c, size_t i) { return c.values[c.positionOfRank(i)]; }
+
+        using Iterator = PositionIterator<AscendingOrder>;
+        Iterator begin() const { return Iterator(&owner, 0); }
+        Iterator end() const { return Iterator(&owner, owner.count); }
+    };
+
+    /**
+     * @brief Descending order view through the permutation index.
+     */
+    class DescendingOrder {
+    private:
+        const MappedMyContainer& owner;
+    public:
+        DescendingOrder(const MappedMyContainer& container) : owner(container) { owner.ensureSortedIndex(); }
+
+        static const T& at(const MappedMyContainer& c, size_t i) {
+            return c.values[c.positionOfRank(c.count - 1 - i)];
+        }
+
+        using Iterator = PositionIterator<DescendingOrder>;
+        Iterator begin() const { return Iterator(&owner, 0); }
+        Iterator end() const { return Iterator(&owner, owner.count); }
+    };
+
+    /**
+     * @brief Side-cross order view (smallest, largest, ...) through the permutation index.
+     */
+    class SideCrossOrder {
+    private:
+        const MappedMyContainer& owner;
+    public:
+        SideCrossOrder(const MappedMyContainer& container) : owner(container) { owner.ensureSortedIndex(); }
+
+        static const T& at(const MappedMyContainer& c, size_t k) {
+            size_t rank = (k % 2 == 0) ? k / 2 : c.count - 1 - k / 2;
+            return c.values[c.positionOfRank(rank)];
+        }
+
+        using Iterator = PositionIterator<SideCrossOrder>;
+        Iterator begin() const { return Iterator(&owner, 0); }
+        Iterator end() const { return Iterator(&owner, owner.count); }
+    };
+};
+
+} // namespace my_container_project
@@ -1,46 +1,340 @@
 #pragma once
 #include <vector>
 #include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <functional>
 #include <iostream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <numeric>
+#include <optional>
 #include <stdexcept>
+#include <type_traits>
+#include <unordered_set>
+#include "Aggregates.hpp"
+#include "BinaryFormat.hpp"
+#include "Generator.hpp"
+#include "OrderStatistics.hpp"
+#include "Ordering.hpp"
+#include "QuantileSketch.hpp"
+#include "SetAlgebra.hpp"
+#include "Sketches.hpp"
+#include "TextFormat.hpp"
+#include "TimerWheel.hpp"
 
 namespace my_container_project {
 
 /**
  * @brief A generic container class supporting custom iteration orders.
+ * The allocator is used for the elements, the cached sorted index and every
+ * view buffer, so a std::pmr resource can back all of a request's allocations.
  * @tparam T Element type (default: int)
+ * @tparam Allocator Allocator for T (default: std::allocator<T>)
  */
-template<typename T = int>
+template<typename T = int, typename Allocator = std::allocator<T>>
 class MyContainer {
+public:
+    using allocator_type = Allocator;
+    using storage_type = std::vector<T, Allocator>;
+    using index_type = std::vector<size_t, typename std::allocator_traits<Allocator>::template rebind_alloc<size_t>>;
+
 private:
-    std::vector<T> elements;
+    template<typename U>
+    using rebound_vector = std::vector<U, typename std::allocator_traits<Allocator>::template rebind_alloc<U>>;
+
+    storage_type elements;
+    uint64_t generation = 0; // Bumped on every mutation of elements
+
+    static constexpr uint64_t kNoSortedIndex = std::numeric_limits<uint64_t>::max();
+    mutable index_type sortedIndex; // Positions of elements in ascending order
+    mutable uint64_t sortedIndexGeneration = kNoSortedIndex; // Generation sortedIndex was built for
+
+    std::optional<OrderStatistics<T, Allocator>> orderStatistics; // Running min/max/median, if enabled
+    mutable std::optional<KllSketch<T, Allocator>> quantileSketch; // Approximate quantiles, if enabled
+    mutable bool quantileSketchStale = false; // KLL cannot delete: rebuilt on the next query after remove()
+    std::optional<BloomFilter<T, Allocator>> membershipFilter; // Early reject for contains()/remove(), if enabled
+    size_t membershipFilterInserts = 0;                        // Inserts since the filter was built
+    double membershipFilterRate = 0.01;
+    mutable std::optional<HyperLogLog<T, Allocator>> distinctCounter; // approxDistinct(), if enabled
+    mutable bool distinctCounterStale = false;                        // HLL cannot delete either
+    using unique_index_type = std::conditional_t<isHashable<T>, // Placeholder type when T has no std::hash
+        std::unordered_set<T, std::hash<T>, std::equal_to<T>, typename std::allocator_traits<Allocator>::template rebind_alloc<T>>,
+        std::nullptr_t>;
+    std::optional<unique_index_type> uniqueIndex; // Set semantics: one copy of each value, if enabled
+
+    static constexpr uint64_t kNoExpiry = std::numeric_limits<uint64_t>::max();
+    rebound_vector<uint64_t> expiryDeadlines; // Per element once any TTL is set (kNoExpiry: none)
+    std::optional<TimerWheel> expiryWheel;     // Engaged by the first addElement(element, ttl)
+    uint64_t clock = 0;                        // Time of the last advanceTime()
+
+    /**
+     * @brief Keeps the optional trackers in step with elements.
+     * The sketch flags are false when merge() already folded in the other
+     * container's sketch.
+     */
+    void trackAdded(const T& element, bool updateQuantiles = true, bool updateDistinct = true) {
+        if (orderStatistics) orderStatistics->insert(element);
+        if (quantileSketch && !quantileSketchStale && updateQuantiles) quantileSketch->update(element);
+        if constexpr (isHashable<T>) {
+            if (membershipFilter) {
+                if (++membershipFilterInserts > membershipFilter->expectedItems()) rebuildMembershipFilter();
+                else membershipFilter->insert(element);
+            }
+            if (distinctCounter && !distinctCounterStale && updateDistinct) distinctCounter->insert(element);
+        }
+    }
+
+    void trackRemoved(const T& element) {
+        if (orderStatistics) orderStatistics->eraseAll(element);
+        if (quantileSketch) quantileSketchStale = true;
+        if (distinctCounter) distinctCounterStale = true;
+    }
+
+    /**
+     * @brief Deadline ttl ticks after the current time, saturating below kNoExpiry.
+     */
+    uint64_t deadlineAfter(uint64_t ttl) const { return ttl >= kNoExpiry - clock ? kNoExpiry - 1 : clock + ttl; }
+
+    void trackExpired(const T& element) {
+        if (orderStatistics) orderStatistics->eraseOne(element);
+        if (quantileSketch) quantileSketchStale = true;
+        if constexpr (isHashable<T>) {
+            if (uniqueIndex) uniqueIndex->erase(element);
+        }
+        if (distinctCounter) distinctCounterStale = true;
+    }
+
+    void trackAppended(size_t from) {
+        for (size_t i = from; i < elements.size(); ++i) trackAdded(elements[i]);
+    }
+
+    /**
+     * @brief Brings the trackers up to date after merge() appended elements
+     *        from position `from` on. Sketches fold in other's sketch when it
+     *        is fresh and compatible (and no incoming element was dropped);
+     *        otherwise the new elements are added one by one.
+     */
+    void trackMerged(size_t from, const MyContainer& other, bool droppedAny) {
+        const bool foldQuantiles = !droppedAny && quantileSketch && !quantileSketchStale && other.quantileSketch &&
+                                   !other.quantileSketchStale && other.quantileSketch->accuracy() == quantileSketch->accuracy();
+        if (foldQuantiles) quantileSketch->merge(*other.quantileSketch);
+        bool foldDistinct = false;
+        if constexpr (isHashable<T>) {
+            foldDistinct = distinctCounter && !distinctCounterStale && other.distinctCounter && !other.distinctCounterStale &&
+                           other.distinctCounter->precisionBits() == distinctCounter->precisionBits();
+            if (foldDistinct) distinctCounter->merge(*other.distinctCounter);
+        }
+        for (size_t i = from; i < elements.size(); ++i) trackAdded(elements[i], !foldQuantiles, !foldDistinct);
+    }
+
+    void trackReplaced() {
+        if (orderStatistics) orderStatistics->assign(elements.begin(), elements.end());
+        if (quantileSketch) quantileSketchStale = true;
+        if constexpr (isHashable<T>) {
+            if (membershipFilter) rebuildMembershipFilter();
+        }
+        if (distinctCounter) distinctCounterStale = true;
+    }
+
+    /**
+     * @brief Rebuilds the Bloom filter from the elements, sized for twice the
+     *        current size so growth rebuilds are amortized O(1) per element.
+     */
+    void rebuildMembershipFilter() {
+        const size_t capacity = std::max(membershipFilter->expectedItems(), 2 * elements.size());
+        membershipFilter.emplace(capacity, membershipFilterRate, get_allocator());
+        for (const auto& el : elements) membershipFilter->insert(el);
+        membershipFilterInserts = elements.size();
+    }
+
+    /**
+     * @brief Drops elements from position `from` on that are already in the
+     *        unique index (or repeat an earlier one), keeping first occurrences.
+     * @return True if any element was dropped.
+     */
+    bool dropDuplicates(size_t from) {
+        return compactWhere(from, [this](size_t i) { return !uniqueIndex->insert(elements[i]).second; }) != 0;
+    }
+
+    /**
+     * @brief Removes the elements from position `from` on for which dead(i)
+     *        is true, in one stable pass, moving expiry deadlines along.
+     * dead(i) is called once per position, in order, before position i is overwritten.
+     * @param cancelTimers Cancel the timers of removed elements; false when
+     *        they have just fired.
+     * @return Number of elements removed.
+     */
+    template<typename Dead>
+    size_t compactWhere(size_t from, Dead dead, bool cancelTimers = true) {
+        const size_t n = elements.size();
+        const bool withDeadlines = expiryWheel.has_value();
+        size_t kept = from;
+        for (size_t i = from; i < n; ++i) {
+            if (dead(i)) {
+                if (cancelTimers && withDeadlines && expiryDeadlines[i] != kNoExpiry)
+                    expiryWheel->cancel(expiryDeadlines[i]);
+                continue;
+            }
+            if (kept != i) {
+                elements[kept] = std::move(elements[i]);
+                if (withDeadlines) expiryDeadlines[kept] = expiryDeadlines[i];
+            }
+            ++kept;
+        }
+        elements.erase(elements.begin() + static_cast<std::ptrdiff_t>(kept), elements.end());
+        if (withDeadlines) expiryDeadlines.resize(kept);
+        return n - kept;
+    }
+
+    /**
+     * @brief Returns the quantile sketch, rebuilding it from the elements if a removal made it stale.
+     */
+    const KllSketch<T, Allocator>& freshQuantileSketch() const {
+        if (quantileSketchStale) {
+            quantileSketch->clear();
+            for (const auto& el : elements) quantileSketch->update(el);
+            quantileSketchStale = false;
+        }
+        return *quantileSketch;
+    }
+
+    static constexpr bool hasMinMaxKernel = std::is_arithmetic<T>::value && !std::is_same<T, bool>::value;
+
+    void requireNonEmpty() const {
+        if (elements.empty()) throw std::runtime_error("Container is empty");
+    }
 
 public:
     MyContainer() = default;
     ~MyContainer() = default;
 
+    /**
+     * @brief Constructs an empty container using the given allocator.
+     * @param alloc Allocator for the elements, the sorted index and view buffers.
+     */
+    explicit MyContainer(const Allocator& alloc)
+        : elements(alloc), sortedIndex(typename index_type::allocator_type(alloc)),
+          expiryDeadlines(typename rebound_vector<uint64_t>::allocator_type(alloc)) {}
+
+    /**
+     * @brief Returns a copy of the allocator used by the container.
+     */
+    allocator_type get_allocator() const { return elements.get_allocator(); }
+
     /**
      * @brief Adds an element to the container.
      * @param element The element to add.
+     * @return False if unique elements are enforced and an equal element is
+     *         already present (the container is then unchanged), else true.
      * @throws ActiveIterationError If there is an active iteration.
      */
-    void addElement(const T& element) {
+    bool addElement(const T& element) {
         if (isIterating) {
             throw ActiveIterationError("Cannot add element during active iteration");
         }
+        if constexpr (isHashable<T>) {
+            if (uniqueIndex && !uniqueIndex->insert(element).second) return false;
+        }
         elements.push_back(element);
+        if (expiryWheel) expiryDeadlines.push_back(kNoExpiry);
+        ++generation;
+        trackAdded(element);
+        return true;
+    }
+
+    /**
+     * @brief Adds an element that expires ttl ticks after the current time.
+     * At the first advanceTime() at or past its deadline it is removed from
+     * the container, and so from every view. TTLs are not persisted by save().
+     * @param element The element to add.
+     * @param ttl Lifetime in the ticks passed to advanceTime().
+     * @return As addElement(element).
+     * @throws ActiveIterationError If there is an active iteration.
+     */
+    bool addElement(const T& element, uint64_t ttl) {
+        if (isIterating) {
+            throw ActiveIterationError("Cannot add element during active iteration");
+        }
+        if (!expiryWheel) {
+            expiryWheel.emplace(clock);
+            expiryDeadlines.assign(elements.size(), kNoExpiry);
+        }
+        if (!addElement(element)) return false;
+        const uint64_t deadline = deadlineAfter(ttl);
+        expiryDeadlines.back() = deadline;
+        expiryWheel->schedule(deadline);
+        return true;
     }
 
+    /**
+     * @brief Moves the clock to now and removes every element whose TTL has run out.
+     * The timer wheel reports whether any deadline has passed; timers of
+     * elements that left the container are cancelled, so one that fires
+     * always has an element to expire. The expired elements are then removed
+     * in a single stable compaction pass, and a cached sorted index is
+     * compacted alongside instead of rebuilt.
+     * @param now New time, in the same ticks as the TTLs.
+     * @return Number of elements removed.
+     * @throws std::invalid_argument If now is before the current time.
+     * @throws ActiveIterationError If there is an active iteration.
+     */
+    size_t advanceTime(uint64_t now) {
+        if (isIterating) {
+            throw ActiveIterationError("Cannot advance time during active iteration");
+        }
+        if (now < clock) throw std::invalid_argument("Time cannot go backwards");
+        clock = now;
+        if (!expiryWheel || expiryWheel->advance(now) == 0) return 0;
+
+        const size_t n = elements.size();
+        constexpr size_t kExpired = std::numeric_limits<size_t>::max();
+        const bool keepIndex = hasCachedSortedIndex();
+        rebound_vector<size_t> newPosition{typename rebound_vector<size_t>::allocator_type(get_allocator())};
+        if (keepIndex) newPosition.resize(n);
+        size_t live = 0;
+        for (size_t i = 0; i < n; ++i) {
+            const bool isExpired = expiryDeadlines[i] <= now;
+            if (isExpired) trackExpired(elements[i]);
+            if (keepIndex) newPosition[i] = isExpired ? kExpired : live++;
+        }
+        const size_t expired = compactWhere(0, [this, now](size_t i) { return expiryDeadlines[i] <= now; }, false);
+        ++generation;
+        if (keepIndex) {
+            size_t out = 0;
+            for (size_t pos : sortedIndex)
+                if (newPosition[pos] != kExpired) sortedIndex[out++] = newPosition[pos];
+            sortedIndex.resize(out);
+            sortedIndexGeneration = generation;
+        }
+        return expired;
+    }
+
+    /**
+     * @brief Time of the last advanceTime() (0 initially).
+     */
+    uint64_t currentTime() const { return clock; }
+
     /**
      * @brief Removes an element from the container.
      * @param element The element to remove.
      * @throws std::runtime_error If the element is not found.
      */
     void remove(const T& element) {
-        auto it = std::remove(elements.begin(), elements.end(), element);
-        if (it == elements.end())
+        if constexpr (isHashable<T>) {
+            if (membershipFilter && !membershipFilter->mightContain(element))
+                throw std::runtime_error("Element not found in container");
+            if (uniqueIndex && uniqueIndex->erase(element) == 0)
+                throw std::runtime_error("Element not found in container");
+        }
+        if (compactWhere(0, [this, &element](size_t i) { return elements[i] == element; }) == 0)
             throw std::runtime_error("Element not found in container");
-        elements.erase(it, elements.end());
+        ++generation;
+        trackRemoved(element);
     }
 
     /**
@@ -55,166 +349,601 @@ public:
      * @brief Accessor for the internal elements vector.
      * @return const reference to the vector of elements.
      */
-    const std::vector<T>& getElements() const { return elements; }
+    const storage_type& getElements() const { return elements; }
 
     /**
-     * @brief Output stream operator for printing the container.
-     * @param os Output stream.
-     * @param cont The container to print.
-     * @return Output stream with elements.
+     * @brief Returns the mutation generation, bumped by every change to the elements.
      */
-    friend std::ostream& operator<<(std::ostream& os, const MyContainer<T>& cont) {
-        for (const auto& el : cont.elements)
-            os << el << " ";
-        return os;
-    }
+    uint64_t getGeneration() const { return generation; }
 
     /**
-     * @brief Ascending order iterator wrapper class.
+     * @brief Returns the positions of the elements in ascending order (stable).
+     * The index is cached and only rebuilt after the container has been mutated;
+     * integral elements are radix sorted.
+     * @return const reference to the cached permutation index.
      */
-    class AscendingOrder {
-    private:
-        MyContainer& container; // Non-const reference to the container
-        std::vector<T> sorted_elements;
-    public:
-        /**
-         * @brief Constructs AscendingOrder iterator from container.
-         * @param container Source container.
-         */
-        AscendingOrder(MyContainer& container) : container(container), sorted_elements(container.elements) {
-            std::sort(sorted_elements.begin(), sorted_elements.end());
+    const index_type& getSortedIndex() const {
+        if (sortedIndexGeneration != generation) {
+            ordering::sortPermutation(elements, sortedIndex, std::less<>(), ordering::Identity());
+            sortedIndexGeneration = generation;
         }
+        return sortedIndex;
+    }
 
-        /**
-         * @brief Iterator class for AscendingOrder.
-         */
+    /**
+     * @brief True if the sorted index is cached for the current generation.
+     */
+    bool hasCachedSortedIndex() const { return sortedIndexGeneration == generation; }
 
-        class Iterator {
-        private:
-            const std::vector<T>& ref;
-            size_t idx;
-        public:
-            Iterator(const std::vector<T>& v, size_t i) : ref(v), idx(i) {}
+    /**
+     * @brief Maintains min, max and median incrementally from now on.
+     * Costs O(n log n) once, then O(log n) per addElement/remove.
+     */
+    void enableOrderStatistics() {
+        if (!orderStatistics) {
+            orderStatistics.emplace(get_allocator());
+            trackReplaced();
+        }
+    }
 
-            const T& operator*() const { return ref.at(idx); }
+    /**
+     * @brief Stops maintaining order statistics and frees them.
+     */
+    void disableOrderStatistics() { orderStatistics.reset(); }
 
-            Iterator& operator++() { ++idx; return *this; } // Prefix increment
+    /**
+     * @brief True if min(), max() and median() are maintained incrementally.
+     */
+    bool tracksOrderStatistics() const { return orderStatistics.has_value(); }
 
-            Iterator operator++(int) { Iterator temp = *this; ++(*this); return temp; } // Postfix increment
+    /**
+     * @brief Smallest element: O(1) when tracked or when the sorted index is cached,
+     *        otherwise an O(n) scan (the aggregates::minmax() kernel for arithmetic types).
+     * @throws std::runtime_error If the container is empty.
+     */
+    T min() const {
+        if (orderStatistics) return orderStatistics->min();
+        requireNonEmpty();
+        if (hasCachedSortedIndex()) return elements[sortedIndex.front()];
+        if constexpr (hasMinMaxKernel) return aggregates::minmax(aggregates::span(elements.data(), elements.size())).first;
+        else return *std::min_element(elements.begin(), elements.end());
+    }
 
-            Iterator& operator--() { --idx; return *this; } // Prefix decrement
+    /**
+     * @brief Largest element: O(1) when tracked or when the sorted index is cached, O(n) otherwise.
+     * @throws std::runtime_error If the container is empty.
+     */
+    T max() const {
+        if (orderStatistics) return orderStatistics->max();
+        requireNonEmpty();
+        if (hasCachedSortedIndex()) return elements[sortedIndex.back()];
+        if constexpr (hasMinMaxKernel) return aggregates::minmax(aggregates::span(elements.data(), elements.size())).second;
+        else return *std::max_element(elements.begin(), elements.end());
+    }
 
-            Iterator operator--(int) { Iterator temp = *this; --(*this); return temp; } // Postfix decrement
+    /**
+     * @brief Lower median (sorted position (n - 1) / 2): O(1) when tracked or
+     *        when the sorted index is cached, O(n) nth_element on a copy otherwise.
+     * @throws std::runtime_error If the container is empty.
+     */
+    T median() const {
+        if (orderStatistics) return orderStatistics->median();
+        requireNonEmpty();
+        const size_t mid = (elements.size() - 1) / 2;
+        if (hasCachedSortedIndex()) return elements[sortedIndex[mid]];
+        storage_type copy(elements);
+        std::nth_element(copy.begin(), copy.begin() + mid, copy.end());
+        return copy[mid];
+    }
 
-            Iterator operator+(size_t n) const { return Iterator(ref, idx + n); } // Advance by n
+    /**
+     * @brief Maintains a KLL quantile sketch from now on (O(k) memory, updated on addElement).
+     * remove() cannot be applied to a sketch, so it is rebuilt from the elements
+     * on the first query after a removal.
+     * @param accuracy Sketch parameter k; rank error is about 2.3 / k^0.97.
+     * @param seed Seed for the sketch's compaction offsets (results are reproducible).
+     */
+    void enableQuantileSketch(size_t accuracy = KllSketch<T, Allocator>::kDefaultK,
+                              uint64_t seed = KllSketch<T, Allocator>::kDefaultSeed) {
+        quantileSketch.emplace(accuracy, seed, get_allocator());
+        for (const auto& el : elements) quantileSketch->update(el);
+        quantileSketchStale = false;
+    }
 
-            Iterator operator-(size_t n) const { return Iterator(ref, idx - n); } // Retreat by n
+    /**
+     * @brief Stops maintaining the quantile sketch and frees it.
+     */
+    void disableQuantileSketch() { quantileSketch.reset(); }
 
-            const T& operator[](size_t n) const { return ref.at(idx + n); } // Access by index
+    /**
+     * @brief The up-to-date quantile sketch, e.g. to merge() sketches of several shards.
+     * @throws std::runtime_error If the sketch is not enabled.
+     */
+    const KllSketch<T, Allocator>& getQuantileSketch() const {
+        if (!quantileSketch) throw std::runtime_error("Quantile sketch is not enabled");
+        return freshQuantileSketch();
+    }
 
-            bool operator!=(const Iterator& other) const { return idx != other.idx || &ref != &other.ref; }
+    /**
+     * @brief Approximate value at normalized rank q in [0, 1] from the sketch.
+     * Without a sketch the answer is exact, read from the cached sorted index.
+     * @throws std::invalid_argument If q is outside [0, 1].
+     * @throws std::runtime_error If the container is empty.
+     */
+    T approxQuantile(double q) const {
+        if (quantileSketch) return freshQuantileSketch().quantile(q);
+        if (!(q >= 0.0 && q <= 1.0)) throw std::invalid_argument("Quantile must be in [0, 1]");
+        requireNonEmpty();
+        const index_type& index = getSortedIndex();
+        size_t pos = static_cast<size_t>(std::ceil(q * static_cast<double>(index.size())));
+        return elements[index[pos == 0 ? 0 : pos - 1]];
+    }
 
-            bool operator==(const Iterator& other) const { return !(*this != other); }
-        };
+    /**
+     * @brief Approximate fraction of the elements that are <= value, from the sketch.
+     * Without a sketch the answer is exact, by binary search of the cached sorted index.
+     * @throws std::runtime_error If the container is empty.
+     */
+    double approxRank(const T& value) const {
+        if (quantileSketch) return freshQuantileSketch().rank(value);
+        requireNonEmpty();
+        const index_type& index = getSortedIndex();
+        auto it = std::upper_bound(index.begin(), index.end(), value,
+                                   [this](const T& v, size_t i) { return v < elements[i]; });
+        return static_cast<double>(it - index.begin()) / static_cast<double>(index.size());
+    }
 
-        Iterator begin() {
-            container.isIterating = true;
-            return Iterator(sorted_elements, 0);
+    /**
+     * @brief Switches to set semantics: addElement() rejects values equal to
+     *        one already present, checked in O(1) through a hash index of the
+     *        elements. Existing duplicates are dropped, keeping the first copy.
+     * @throws ActiveIterationError If there is an active iteration.
+     */
+    void enableUniqueElements() {
+        static_assert(isHashable<T>, "Unique elements need std::hash<T>");
+        if (isIterating) {
+            throw ActiveIterationError("Cannot enable unique elements during active iteration");
         }
-        Iterator end() {
-            container.isIterating = false;
-            return Iterator(sorted_elements, sorted_elements.size());
+        uniqueIndex.emplace(elements.size(), get_allocator());
+        if (dropDuplicates(0)) {
+            ++generation;
+            trackReplaced();
         }
-    };
+    }
 
     /**
-     * @brief Descending order iterator wrapper class.
+     * @brief Returns to multiset semantics and frees the hash index.
      */
-    class DescendingOrder {
-    private:
-        MyContainer& container; // Non-const reference to the container
-        std::vector<T> sorted_elements;
-    public:
-        /**
-         * @brief Constructs DescendingOrder iterator from container.
-         * @param container Source container.
-         */
-        DescendingOrder(MyContainer& container) : container(container), sorted_elements(container.elements) {
-            std::sort(sorted_elements.begin(), sorted_elements.end(), std::greater<T>());
+    void disableUniqueElements() { uniqueIndex.reset(); }
+
+    /**
+     * @brief True if addElement() rejects duplicates.
+     */
+    bool enforcesUniqueElements() const { return uniqueIndex.has_value(); }
+
+    /**
+     * @brief Maintains a Bloom filter so contains() and remove() reject most
+     *        absent elements without scanning. Removed elements stay in the
+     *        filter (they only cost false positives); the filter is rebuilt
+     *        at twice the size whenever the container outgrows it.
+     * @param expectedItems Initial capacity of the filter.
+     * @param falsePositiveRate Target false-positive rate.
+     * @throws std::invalid_argument If the rate is not in (0, 1).
+     */
+    void enableMembershipFilter(size_t expectedItems = 1024, double falsePositiveRate = 0.01) {
+        static_assert(isHashable<T>, "The membership filter needs std::hash<T>");
+        membershipFilter.emplace(std::max(expectedItems, 2 * elements.size()), falsePositiveRate, get_allocator());
+        membershipFilterRate = falsePositiveRate;
+        for (const auto& el : elements) membershipFilter->insert(el);
+        membershipFilterInserts = elements.size();
+    }
+
+    /**
+     * @brief Stops maintaining the Bloom filter and frees it.
+     */
+    void disableMembershipFilter() { membershipFilter.reset(); }
+
+    /**
+     * @brief Bytes used by the Bloom filter (0 if disabled).
+     */
+    size_t membershipFilterMemory() const { return membershipFilter ? membershipFilter->memoryUsage() : 0; }
+
+    /**
+     * @brief True if the container holds an element equal to value.
+     * With a membership filter, most absent values are rejected without a scan.
+     */
+    bool contains(const T& value) const {
+        if constexpr (isHashable<T>) {
+            if (uniqueIndex) return uniqueIndex->count(value) != 0;
+            if (membershipFilter && !membershipFilter->mightContain(value)) return false;
         }
+        return std::find(elements.begin(), elements.end(), value) != elements.end();
+    }
 
-        class Iterator {
-        private:
-            const std::vector<T>& ref;
-            size_t idx;
-        public:
-            Iterator(const std::vector<T>& v, size_t i) : ref(v), idx(i) {}
+    /**
+     * @brief Maintains a HyperLogLog distinct-count estimate (2^precision bytes).
+     * remove() cannot be applied to it, so it is rebuilt on the next query after a removal.
+     * @param precision Register bits; standard error is about 1.04 / sqrt(2^precision).
+     * @throws std::invalid_argument If precision is outside [4, 18].
+     */
+    void enableDistinctCounter(unsigned precision = HyperLogLog<T, Allocator>::kDefaultPrecision) {
+        static_assert(isHashable<T>, "The distinct counter needs std::hash<T>");
+        distinctCounter.emplace(precision, get_allocator());
+        for (const auto& el : elements) distinctCounter->insert(el);
+        distinctCounterStale = false;
+    }
 
-            const T& operator*() const { return ref.at(idx); }
+    /**
+     * @brief Stops maintaining the distinct-count estimate and frees it.
+     */
+    void disableDistinctCounter() { distinctCounter.reset(); }
 
-            Iterator& operator++() { ++idx; return *this; } // Prefix increment
+    /**
+     * @brief Approximate number of distinct elements from the HyperLogLog.
+     * Without one, the exact count is the size when unique elements are
+     * enforced, else it is taken from the cached sorted index.
+     */
+    double approxDistinct() const {
+        if constexpr (isHashable<T>) {
+            if (uniqueIndex) return static_cast<double>(elements.size());
+            if (distinctCounter) {
+                if (distinctCounterStale) {
+                    distinctCounter->clear();
+                    for (const auto& el : elements) distinctCounter->insert(el);
+                    distinctCounterStale = false;
+                }
+                return distinctCounter->estimate();
+            }
+        }
+        const index_type& index = getSortedIndex();
+        size_t distinct = index.empty() ? 0 : 1;
+        for (size_t i = 1; i < index.size(); ++i)
+            if (elements[index[i - 1]] < elements[index[i]]) ++distinct;
+        return static_cast<double>(distinct);
+    }
 
-            Iterator operator++(int) { Iterator temp = *this; ++(*this); return temp; } // Postfix increment
+    /**
+     * @brief Ascending multiset union with other (like std::set_union): a value
+     *        held m times here and n times in other is kept max(m, n) times.
+     * Merges the two cached sorted indices in linear time, or gallops the
+     * smaller through the larger when the sizes differ by set_algebra::kGallopRatio
+     * or more. The result's sorted index is already valid.
+     */
+    MyContainer unionWith(const MyContainer& other) const { return combinedWith<set_algebra::kUnion>(other); }
 
-            Iterator& operator--() { --idx; return *this; } // Prefix decrement
+    /**
+     * @brief Ascending multiset intersection with other (min(m, n) copies).
+     * When both containers enforce unique elements, 32-bit integers use the
+     * SSE2 block-intersection kernel.
+     */
+    MyContainer intersectWith(const MyContainer& other) const { return combinedWith<set_algebra::kIntersection>(other); }
 
-            Iterator operator--(int) { Iterator temp = *this; --(*this); return temp; } // Postfix decrement
+    /**
+     * @brief Ascending elements of this container not matched in other (m - n copies).
+     */
+    MyContainer differenceWith(const MyContainer& other) const { return combinedWith<set_algebra::kDifference>(other); }
 
-            Iterator operator+(size_t n) const { return Iterator(ref, idx + n); } // Advance by n
+    /**
+     * @brief Ascending elements of either container not matched in the other (|m - n| copies).
+     */
+    MyContainer symmetricDifference(const MyContainer& other) const {
+        return combinedWith<set_algebra::kSymmetricDifference>(other);
+    }
 
-            Iterator operator-(size_t n) const { return Iterator(ref, idx - n); } // Retreat by n
+    /**
+     * @brief Streaming forms: call sink(const T&) for each result value in
+     *        ascending order instead of building a container.
+     */
+    template<typename Sink>
+    void unionWith(const MyContainer& other, Sink&& sink) const { combineWith<set_algebra::kUnion>(other, sink); }
 
-            const T& operator[](size_t n) const { return ref.at(idx + n); } // Access by index
+    template<typename Sink>
+    void intersectWith(const MyContainer& other, Sink&& sink) const { combineWith<set_algebra::kIntersection>(other, sink); }
 
-            bool operator!=(const Iterator& other) const { return idx != other.idx || &ref != &other.ref; }
+    template<typename Sink>
+    void differenceWith(const MyContainer& other, Sink&& sink) const { combineWith<set_algebra::kDifference>(other, sink); }
 
-            bool operator==(const Iterator& other) const { return !(*this != other); }
-        };
+    template<typename Sink>
+    void symmetricDifference(const MyContainer& other, Sink&& sink) const {
+        combineWith<set_algebra::kSymmetricDifference>(other, sink);
+    }
 
-        Iterator begin() {
-            container.isIterating = true;
-            return Iterator(sorted_elements, 0);
+    /**
+     * @brief Output stream operator for printing the container.
+     * Streams with default formatting are written through the buffered
+     * to_chars formatter in large chunks; the output is byte-identical.
+     * @param os Output stream.
+     * @param cont The container to print.
+     * @return Output stream with elements.
+     */
+    friend std::ostream& operator<<(std::ostream& os, const MyContainer& cont) {
+        if (text_format::hasFastFormat<T> && text_format::usesDefaultFormatting(os)) {
+            text_format::formatRange(cont.elements.begin(), cont.elements.end(),
+                                     [&os](const char* data, size_t n) { os.write(data, static_cast<std::streamsize>(n)); },
+                                     os.precision());
+            return os;
         }
-        Iterator end() {
-            container.isIterating = false;
-            return Iterator(sorted_elements, sorted_elements.size());
+        for (const auto& el : cont.elements)
+            os << el << " ";
+        return os;
+    }
+
+    /**
+     * @brief Writes the container in operator<< format to a stdio stream.
+     * @param out Destination stream.
+     * @throws std::runtime_error On a write error.
+     */
+    void writeTo(std::FILE* out) const {
+        text_format::formatRange(elements.begin(), elements.end(), text_format::fileSink(out));
+    }
+
+    /**
+     * @brief Writes the container in operator<< format to a file descriptor.
+     * @param fd Destination file descriptor.
+     * @throws std::runtime_error On a write error.
+     */
+    void writeTo(int fd) const {
+        text_format::formatRange(elements.begin(), elements.end(), text_format::fdSink(fd));
+    }
+
+    /**
+     * @brief Saves the container to a versioned binary file.
+     * Trivially copyable elements are written as one raw block; strings are
+     * written as length-prefixed records.
+     * @param path Destination file, overwritten if it exists.
+     * @param withSortedIndex Also persist the sorted index and its generation,
+     *        so sorted views are available after load() without sorting.
+     * TTLs are not saved: load() gives every element no expiry.
+     * @throws std::runtime_error If the file cannot be written.
+     */
+    void save(const std::string& path, bool withSortedIndex = false) const {
+        binary_format::save(path, elements, generation, withSortedIndex ? &getSortedIndex() : nullptr);
+    }
+
+    /**
+     * @brief Replaces the contents of the container with a file written by save().
+     * Restores the saved generation and, if present, the persisted sorted index.
+     * @param path Source file.
+     * @throws ActiveIterationError If there is an active iteration.
+     * @throws std::runtime_error If the file is missing, truncated or holds another type.
+     */
+    void load(const std::string& path) {
+        if (isIterating) {
+            throw ActiveIterationError("Cannot load during active iteration");
         }
-    };
+        binary_format::FileHeader h = binary_format::load(path, elements, &sortedIndex);
+        generation = h.generation;
+        sortedIndexGeneration = (h.flags & binary_format::kHasSortedIndex) ? generation : kNoSortedIndex;
+        if (expiryWheel) {
+            expiryWheel->clear();
+            expiryDeadlines.assign(elements.size(), kNoExpiry);
+        }
+        if constexpr (isHashable<T>) {
+            if (uniqueIndex) {
+                uniqueIndex->clear();
+                if (dropDuplicates(0)) ++generation;
+            }
+        }
+        trackReplaced();
+    }
+
+    /**
+     * @brief Appends whitespace-delimited values read from a stream.
+     * Accepts the format written by operator<<, so text output round-trips.
+     * @param in Input stream.
+     * @throws ActiveIterationError If there is an active iteration.
+     * @throws std::runtime_error On a malformed value; the container is then unchanged.
+     */
+    void loadText(std::istream& in) {
+        if (isIterating) {
+            throw ActiveIterationError("Cannot load during active iteration");
+        }
+        const size_t before = elements.size();
+        if (text_format::parseStream(in, elements)) ++generation;
+        if (expiryWheel) expiryDeadlines.resize(elements.size(), kNoExpiry);
+        if constexpr (isHashable<T>) {
+            if (uniqueIndex) dropDuplicates(before);
+        }
+        trackAppended(before);
+    }
+
+    /**
+     * @brief Appends whitespace-delimited values read from a text file.
+     * @param path Source file.
+     * @throws ActiveIterationError If there is an active iteration.
+     * @throws std::runtime_error If the file cannot be read or holds a malformed value.
+     */
+    void loadText(const std::string& path) {
+        if (isIterating) {
+            throw ActiveIterationError("Cannot load during active iteration");
+        }
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        if (!in) throw std::runtime_error("Cannot open file for reading: " + path);
+        const uint64_t fileSize = static_cast<uint64_t>(in.tellg());
+        in.seekg(0);
+        const size_t before = elements.size();
+        if (text_format::parseStream(in, elements, fileSize)) ++generation;
+        if (expiryWheel) expiryDeadlines.resize(elements.size(), kNoExpiry);
+        if constexpr (isHashable<T>) {
+            if (uniqueIndex) dropDuplicates(before);
+        }
+        trackAppended(before);
+    }
+
+    /**
+     * @brief Moves every element of other to the end of this container, e.g.
+     *        to combine shards. Elements are moved, not copied; an empty
+     *        container takes over other's storage outright. If both sorted
+     *        indices are cached, they are merged in linear time (stable, this
+     *        container's elements first among equals) so the next sorted view
+     *        does not sort. other is left empty.
+     * With unique elements enforced, incoming duplicates are dropped.
+     * Elements of other with a TTL keep the time they had left on other's
+     * clock, measured from this container's current time.
+     * @param other Source container; must not be this container.
+     * @throws ActiveIterationError If either container has an active iteration.
+     * @throws std::invalid_argument If other is this container.
+     */
+    void merge(MyContainer&& other) {
+        if (&other == this) throw std::invalid_argument("Cannot merge a container into itself");
+        if (isIterating || other.isIterating) {
+            throw ActiveIterationError("Cannot merge during active iteration");
+        }
+        const size_t before = elements.size(), incoming = other.elements.size();
+        // An empty side counts as sorted; its index may be stale, so it is not read
+        const bool mergeIndex = (before == 0 || hasCachedSortedIndex()) && (incoming == 0 || other.hasCachedSortedIndex());
+        if (elements.empty() && elements.get_allocator() == other.elements.get_allocator()) {
+            elements.swap(other.elements);
+        } else {
+            elements.reserve(before + incoming);
+            elements.insert(elements.end(), std::make_move_iterator(other.elements.begin()),
+                            std::make_move_iterator(other.elements.end()));
+        }
+        if (other.expiryWheel && !expiryWheel) {
+            expiryWheel.emplace(clock);
+            expiryDeadlines.assign(before, kNoExpiry);
+        }
+        if (expiryWheel) {
+            if (other.expiryWheel) {
+                // Deadlines are absolute on other's clock: keep the time left, not the deadline
+                for (uint64_t deadline : other.expiryDeadlines) {
+                    if (deadline != kNoExpiry) {
+                        deadline = deadlineAfter(deadline > other.clock ? deadline - other.clock : 0);
+                        expiryWheel->schedule(deadline);
+                    }
+                    expiryDeadlines.push_back(deadline);
+                }
+            } else {
+                expiryDeadlines.resize(elements.size(), kNoExpiry);
+            }
+        }
+        bool droppedAny = false;
+        if constexpr (isHashable<T>) {
+            if (uniqueIndex) droppedAny = dropDuplicates(before);
+        }
+        ++generation;
+        if (mergeIndex && !droppedAny) {
+            index_type merged{sortedIndex.get_allocator()};
+            merged.reserve(elements.size());
+            size_t i = 0, j = 0;
+            const size_t na = before == 0 ? 0 : sortedIndex.size(), nb = incoming == 0 ? 0 : other.sortedIndex.size();
+            while (i < na && j < nb) { // Stable: equal elements take this container's position first
+                const size_t x = sortedIndex[i], y = before + other.sortedIndex[j];
+                if (elements[y] < elements[x]) { merged.push_back(y); ++j; }
+                else { merged.push_back(x); ++i; }
+            }
+            for (; i < na; ++i) merged.push_back(sortedIndex[i]);
+            for (; j < nb; ++j) merged.push_back(before + other.sortedIndex[j]);
+            sortedIndex.swap(merged);
+            sortedIndexGeneration = generation;
+        }
+        trackMerged(before, other, droppedAny);
+
+        other.elements.clear();
+        other.expiryDeadlines.clear();
+        if (other.expiryWheel) other.expiryWheel->clear();
+        ++other.generation;
+        if constexpr (isHashable<T>) {
+            if (other.uniqueIndex) other.uniqueIndex->clear();
+        }
+        other.trackReplaced();
+    }
+
+    /**
+     * @brief Arrangement of a sorted view.
+     */
+    enum class SortedLayout { Ascending, Descending, SideCross, UniqueAscending, UniqueDescending };
 
     /**
-     * @brief Side-cross order iterator: left-right alternation from sorted list.
+     * @brief Sorted view ordered by comp(proj(a), proj(b)), like std::ranges::sort.
+     * With the default std::less<> and identity projection the view is built
+     * from the cached sorted index; any other ordering computes its own
+     * permutation (key extraction and radix sort for arithmetic keys, see
+     * ordering::sortPermutation). Equal elements keep insertion order; the
+     * unique layouts keep only the first of each run of equal keys, dropping
+     * the rest in the same pass, so the buffer holds distinct values only.
+     * @tparam Layout Ascending, descending (reversed ascending), side-cross,
+     *         or ascending/descending without duplicates.
+     * @tparam Compare Strict weak ordering on projected keys.
+     * @tparam Projection Callable applied to each element (member pointers allowed).
      */
-    class SideCrossOrder {
+    template<SortedLayout Layout, typename Compare = std::less<>, typename Projection = ordering::Identity>
+    class SortedOrder {
     private:
         MyContainer& container; // Non-const reference to the container
-        std::vector<T> cross_ordered;
+        storage_type ordered;
+
+        static constexpr bool kUsesCachedIndex =
+            (std::is_same<Compare, std::less<>>::value || std::is_same<Compare, std::less<T>>::value) &&
+            std::is_same<Projection, ordering::Identity>::value;
+
+        void arrange(const index_type& index, const Compare& comp, const Projection& proj) {
+            const storage_type& temp = container.elements;
+            if constexpr (Layout == SortedLayout::UniqueAscending || Layout == SortedLayout::UniqueDescending) {
+                // Position i starts a run of equal keys if it is first or its predecessor sorts strictly before it
+                auto startsRun = [&](size_t i) {
+                    return i == 0 || std::invoke(comp, std::invoke(proj, temp[index[i - 1]]), std::invoke(proj, temp[index[i]]));
+                };
+                if constexpr (Layout == SortedLayout::UniqueAscending) {
+                    for (size_t i = 0; i < index.size(); ++i)
+                        if (startsRun(i)) ordered.push_back(temp[index[i]]);
+                } else {
+                    for (size_t i = index.size(); i > 0; --i)
+                        if (startsRun(i - 1)) ordered.push_back(temp[index[i - 1]]);
+                }
+                return;
+            }
+            ordered.reserve(index.size());
+            if constexpr (Layout == SortedLayout::Ascending) {
+                for (size_t i : index) ordered.push_back(temp[i]);
+            } else if constexpr (Layout == SortedLayout::Descending) {
+                for (size_t i = index.size(); i > 0; --i) ordered.push_back(temp[index[i - 1]]);
+            } else {
+                size_t left = 0, right = index.size();
+                while (left < right) {
+                    ordered.push_back(temp[index[left++]]);
+                    if (left < right) ordered.push_back(temp[index[--right]]);
+                }
+            }
+        }
+
     public:
         /**
-         * @brief Constructs SideCrossOrder iterator from container.
+         * @brief Constructs the view from container.
          * @param container Source container.
+         * @param comp Comparator on projected keys.
+         * @param proj Projection applied to each element.
          */
-        SideCrossOrder(MyContainer& container) : container(container) {
-            std::vector<T> temp = container.elements;
-            std::sort(temp.begin(), temp.end());
-            size_t left = 0, right = temp.size() ? temp.size() - 1 : 0;
-            while (!temp.empty() && left <= right) {
-                if (left == right) {
-                    cross_ordered.push_back(temp[left]);
-                } else {
-                    cross_ordered.push_back(temp[left]);
-                    cross_ordered.push_back(temp[right]);
-                }
-                ++left;
-                if (right > 0) --right;
+        SortedOrder(MyContainer& container, Compare comp = Compare(), Projection proj = Projection())
+            : SortedOrder(container, container.get_allocator(), std::move(comp), std::move(proj)) {}
+
+        /**
+         * @brief Constructs the view with its buffer from alloc.
+         * @param container Source container.
+         * @param alloc Allocator for the view's buffer.
+         * @param comp Comparator on projected keys.
+         * @param proj Projection applied to each element.
+         */
+        SortedOrder(MyContainer& container, const Allocator& alloc, Compare comp = Compare(), Projection proj = Projection())
+            : container(container), ordered(alloc) {
+            if constexpr (kUsesCachedIndex) {
+                arrange(container.getSortedIndex(), comp, proj);
+            } else {
+                index_type index{typename index_type::allocator_type(alloc)};
+                ordering::sortPermutation(container.elements, index, comp, proj);
+                arrange(index, comp, proj);
             }
         }
 
+        /**
+         * @brief Iterator class for sorted views.
+         */
         class Iterator {
         private:
-            const std::vector<T>& ref;
+            const storage_type& ref;
             size_t idx;
         public:
-            Iterator(const std::vector<T>& v, size_t i) : ref(v), idx(i) {}
+            Iterator(const storage_type& v, size_t i) : ref(v), idx(i) {}
 
             const T& operator*() const { return ref.at(idx); }
 
@@ -237,32 +966,90 @@ public:
             bool operator==(const Iterator& other) const { return !(*this != other); }
         };
 
+        /**
+         * @brief Contiguous view buffer (used by the aggregates kernels).
+         */
+        const T* data() const { return ordered.data(); }
+        size_t size() const { return ordered.size(); }
+
         Iterator begin() {
             container.isIterating = true;
-            return Iterator(cross_ordered, 0);
+            return Iterator(ordered, 0);
         }
         Iterator end() {
             container.isIterating = false;
-            return Iterator(cross_ordered, cross_ordered.size());
+            return Iterator(ordered, ordered.size());
         }
     };
 
+    /// Ascending order iterator (from smallest to largest, by operator<).
+    using AscendingOrder = SortedOrder<SortedLayout::Ascending>;
+    /// Descending order iterator (from largest to smallest, by operator<).
+    using DescendingOrder = SortedOrder<SortedLayout::Descending>;
+    /// Side-cross order iterator: left-right alternation from the sorted list.
+    using SideCrossOrder = SortedOrder<SortedLayout::SideCross>;
+    /// Distinct elements from smallest to largest (first copy of each).
+    using UniqueAscendingOrder = SortedOrder<SortedLayout::UniqueAscending>;
+    /// Distinct elements from largest to smallest (the reverse of UniqueAscendingOrder).
+    using UniqueDescendingOrder = SortedOrder<SortedLayout::UniqueDescending>;
+
+    /// Ascending order by a custom comparator and projection.
+    template<typename Compare = std::less<>, typename Projection = ordering::Identity>
+    using AscendingOrderBy = SortedOrder<SortedLayout::Ascending, Compare, Projection>;
+    /// Reverse of AscendingOrderBy with the same comparator and projection.
+    template<typename Compare = std::less<>, typename Projection = ordering::Identity>
+    using DescendingOrderBy = SortedOrder<SortedLayout::Descending, Compare, Projection>;
+    /// Side-cross order by a custom comparator and projection.
+    template<typename Compare = std::less<>, typename Projection = ordering::Identity>
+    using SideCrossOrderBy = SortedOrder<SortedLayout::SideCross, Compare, Projection>;
+    /// Distinct elements by a custom comparator and projection (keys equivalent under comp are duplicates).
+    template<typename Compare = std::less<>, typename Projection = ordering::Identity>
+    using UniqueAscendingOrderBy = SortedOrder<SortedLayout::UniqueAscending, Compare, Projection>;
+    /// Reverse of UniqueAscendingOrderBy with the same comparator and projection.
+    template<typename Compare = std::less<>, typename Projection = ordering::Identity>
+    using UniqueDescendingOrderBy = SortedOrder<SortedLayout::UniqueDescending, Compare, Projection>;
+
+    /**
+     * @brief Returns an ascending view ordered by comp(proj(a), proj(b)).
+     * e.g. c.ascendingBy({}, &Record::timestamp) or c.ascendingBy(std::greater<>()).
+     */
+    template<typename Compare = std::less<>, typename Projection = ordering::Identity>
+    AscendingOrderBy<Compare, Projection> ascendingBy(Compare comp = Compare(), Projection proj = Projection()) {
+        return AscendingOrderBy<Compare, Projection>(*this, std::move(comp), std::move(proj));
+    }
+
+    /**
+     * @brief Returns a descending view (reversed ascendingBy) ordered by comp(proj(a), proj(b)).
+     */
+    template<typename Compare = std::less<>, typename Projection = ordering::Identity>
+    DescendingOrderBy<Compare, Projection> descendingBy(Compare comp = Compare(), Projection proj = Projection()) {
+        return DescendingOrderBy<Compare, Projection>(*this, std::move(comp), std::move(proj));
+    }
+
+    /**
+     * @brief Returns a side-cross view ordered by comp(proj(a), proj(b)).
+     */
+    template<typename Compare = std::less<>, typename Projection = ordering::Identity>
+    SideCrossOrderBy<Compare, Projection> sideCrossBy(Compare comp = Compare(), Projection proj = Projection()) {
+        return SideCrossOrderBy<Compare, Projection>(*this, std::move(comp), std::move(proj));
+    }
+
     /**
      * @brief Reverse order iterator (original insertion order, reversed).
      */
     class ReverseOrder {
     private:
-        const std::vector<T>& ref_elements;
+        const storage_type& ref_elements;
     public:
         ReverseOrder(const MyContainer& container)
             : ref_elements(container.elements) {}
 
         class Iterator {
         private:
-            const std::vector<T>& ref;
+            const storage_type& ref;
             int idx;
         public:
-            Iterator(const std::vector<T>& v, int i) : ref(v), idx(i) {}
+            Iterator(const storage_type& v, int i) : ref(v), idx(i) {}
             const T& operator*() const { return ref.at(idx); }
             Iterator& operator++() { --idx; return *this; }
             bool operator!=(const Iterator& other) const { return idx != other.idx || &ref != &other.ref; }
@@ -278,17 +1065,17 @@ public:
      */
     class Order {
     private:
-        const std::vector<T>& ref_elements;
+        const storage_type& ref_elements;
     public:
         Order(const MyContainer& container)
             : ref_elements(container.elements) {}
 
         class Iterator {
         private:
-            const std::vector<T>& ref;
+            const storage_type& ref;
             size_t idx;
         public:
-            Iterator(const std::vector<T>& v, size_t i) : ref(v), idx(i) {}
+            Iterator(const storage_type& v, size_t i) : ref(v), idx(i) {}
 
             const T& operator*() const { return ref.at(idx); }
 
@@ -323,7 +1110,7 @@ public:
      */
     class MiddleOutOrder {
     private:
-        std::vector<T> midout_elements;
+        storage_type midout_elements;
 
     public:
         /**
@@ -331,8 +1118,15 @@ public:
          * If number of elements is even, middle index is rounded down.
          * @param container Source container.
          */
-        MiddleOutOrder(const MyContainer& container) {
-            const std::vector<T>& temp = container.getElements();
+        MiddleOutOrder(const MyContainer& container) : MiddleOutOrder(container, container.get_allocator()) {}
+
+        /**
+         * @brief Constructs a middle-out order iterator with its buffer from alloc.
+         * @param container Source container.
+         * @param alloc Allocator for the view's buffer.
+         */
+        MiddleOutOrder(const MyContainer& container, const Allocator& alloc) : midout_elements(alloc) {
+            const storage_type& temp = container.getElements();
             size_t n = temp.size();
             if (n == 0) return;
 
@@ -358,6 +1152,93 @@ public:
         auto end() const { return midout_elements.end(); }
     };
 
+#if defined(__cpp_impl_coroutine)
+    /**
+     * @brief Lazily yields elements in insertion order.
+     */
+    Generator<const T&> orderGenerator() const {
+        for (const auto& el : elements)
+            co_yield el;
+    }
+
+    /**
+     * @brief Lazily yields elements in reverse insertion order.
+     */
+    Generator<const T&> reverseOrderGenerator() const {
+        for (size_t i = elements.size(); i > 0; --i)
+            co_yield elements[i - 1];
+    }
+
+    /**
+     * @brief Lazily yields elements in middle-out order without building a buffer.
+     * Uses the same middle index rule as MiddleOutOrder.
+     */
+    Generator<const T&> middleOutGenerator() const {
+        size_t n = elements.size();
+        if (n == 0) co_return;
+        size_t mid = (n % 2 == 0) ? (n / 2 - 1) : (n / 2);
+        co_yield elements[mid];
+        for (size_t step = 1; step <= mid || mid + step < n; ++step) {
+            if (step <= mid) co_yield elements[mid - step];
+            if (mid + step < n) co_yield elements[mid + step];
+        }
+    }
+
+    /**
+     * @brief Yields elements in ascending order.
+     * Sorts pointers to the elements up front; no element is copied.
+     */
+    Generator<const T&> ascendingGenerator() const {
+        rebound_vector<const T*> sorted = sortedPointers();
+        for (const T* p : sorted)
+            co_yield *p;
+    }
+
+    /**
+     * @brief Yields elements in ascending order, sorting lazily.
+     * Builds a heap in O(n) and pays O(log n) per element actually consumed,
+     * so consumers that stop early never pay for a full sort.
+     */
+    Generator<const T&> lazyAscendingGenerator() const {
+        rebound_vector<const T*> heap{typename rebound_vector<const T*>::allocator_type(get_allocator())};
+        heap.reserve(elements.size());
+        for (const auto& el : elements) heap.push_back(&el);
+        auto greater = [](const T* a, const T* b) { return *b < *a; };
+        std::make_heap(heap.begin(), heap.end(), greater);
+        while (!heap.empty()) {
+            std::pop_heap(heap.begin(), heap.end(), greater);
+            const T* top = heap.back();
+            heap.pop_back();
+            co_yield *top;
+        }
+    }
+
+    /**
+     * @brief Yields elements in descending order.
+     */
+    Generator<const T&> descendingGenerator() const {
+        rebound_vector<const T*> sorted = sortedPointers();
+        for (size_t i = sorted.size(); i > 0; --i)
+            co_yield *sorted[i - 1];
+    }
+
+    /**
+     * @brief Yields elements in side-cross order (smallest, largest, ...).
+     */
+    Generator<const T&> sideCrossGenerator() const {
+        rebound_vector<const T*> sorted = sortedPointers();
+        size_t left = 0, right = sorted.size();
+        while (left < right) {
+            co_yield *sorted[left];
+            ++left;
+            if (left < right) {
+                --right;
+                co_yield *sorted[right];
+            }
+        }
+    }
+#endif // __cpp_impl_coroutine
+
     /**
      * @brief Exception class for active iteration errors.
      */
@@ -367,6 +1248,74 @@ public:
     };
 
     bool isIterating = false; // Track active iteration state
+
+private:
+    /**
+     * @brief Returns pointers to the elements, sorted by value.
+     */
+    rebound_vector<const T*> sortedPointers() const {
+        const index_type& index = getSortedIndex();
+        rebound_vector<const T*> sorted{typename rebound_vector<const T*>::allocator_type(get_allocator())};
+        sorted.reserve(index.size());
+        for (size_t i : index) sorted.push_back(&elements[i]);
+        return sorted;
+    }
+
+    /**
+     * @brief Runs a set_algebra operation over both cached sorted indices.
+     */
+    template<unsigned Ops, typename Sink>
+    void combineWith(const MyContainer& other, Sink& sink) const {
+        const index_type& mine = getSortedIndex();
+        const index_type& theirs = other.getSortedIndex();
+        if constexpr (std::is_arithmetic<T>::value) {
+            // A merge through the permutations stalls on one dependent cache miss
+            // per step; copying both sides out first lets those loads overlap.
+            if (!set_algebra::isSkewed(mine.size(), theirs.size())) {
+                rebound_vector<T> left{typename rebound_vector<T>::allocator_type(get_allocator())};
+                rebound_vector<T> right{typename rebound_vector<T>::allocator_type(get_allocator())};
+                left.reserve(mine.size());
+                right.reserve(theirs.size());
+                for (size_t i : mine) left.push_back(elements[i]);
+                for (size_t i : theirs) right.push_back(other.elements[i]);
+                auto a = aggregates::span(left.data(), left.size());
+                auto b = aggregates::span(right.data(), right.size());
+                if (Ops == set_algebra::kIntersection && uniqueIndex && other.uniqueIndex)
+                    set_algebra::intersectDistinct(a, b, sink); // Strictly ascending: the block kernel applies
+                else
+                    set_algebra::combine<Ops>(a, b, sink);
+                return;
+            }
+        }
+        set_algebra::combine<Ops>(aggregates::gather(elements.data(), mine.data(), mine.size()),
+                                  aggregates::gather(other.elements.data(), theirs.data(), theirs.size()), sink);
+    }
+
+    /**
+     * @brief Materializes a set_algebra operation; the output is ascending, so
+     *        its sorted index is the identity.
+     */
+    template<unsigned Ops>
+    MyContainer combinedWith(const MyContainer& other) const {
+        MyContainer result(get_allocator());
+        auto append = [&result](const T& value) { result.elements.push_back(value); };
+        combineWith<Ops>(other, append);
+        result.sortedIndex.resize(result.elements.size());
+        std::iota(result.sortedIndex.begin(), result.sortedIndex.end(), size_t(0));
+        result.sortedIndexGeneration = result.generation;
+        return result;
+    }
 };
 
+namespace pmr {
+
+/**
+ * @brief MyContainer using std::pmr::polymorphic_allocator, e.g. over a
+ *        per-request std::pmr::monotonic_buffer_resource.
+ */
+template<typename T = int>
+using MyContainer = my_container_project::MyContainer<T, std::pmr::polymorphic_allocator<T>>;
+
+} // namespace pmr
+
 } // namespace my_container_project
\ No newline at end of file
@@ -0,0 +1,111 @@
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <set>
+#include <stdexcept>
+
+namespace my_container_project {
+
+/**
+ * @brief Running min, max and lower median of a multiset of values.
+ *
+ * Values are split between two balanced multisets: `lower` holds the smaller
+ * ceil(n/2) values and `upper` the rest. The minimum, the lower median and
+ * the maximum are the first of `lower`, the last of `lower` and the last of
+ * `upper`, each O(1); insert and erase are O(log n).
+ * @tparam T Element type with operator<
+ * @tparam Allocator Allocator rebound for the tree nodes
+ */
+template<typename T, typename Allocator = std::allocator<T>>
+class OrderStatistics {
+private:
+    using Tree = std::multiset<T, std::less<T>, typename std::allocator_traits<Allocator>::template rebind_alloc<T>>;
+    Tree lower; // Smaller half, including the lower median
+    Tree upper; // Larger half
+
+    void rebalance() {
+        while (lower.size() > upper.size() + 1) {
+            auto last = std::prev(lower.end());
+            upper.insert(upper.begin(), *last);
+            lower.erase(last);
+        }
+        while (upper.size() > lower.size()) {
+            lower.insert(lower.end(), *upper.begin());
+            upper.erase(upper.begin());
+        }
+    }
+
+    void requireNonEmpty() const {
+        if (lower.empty()) throw std::runtime_error("Container is empty");
+    }
+
+public:
+    explicit OrderStatistics(const Allocator& alloc = Allocator()) : lower(alloc), upper(alloc) {}
+
+    /**
+     * @brief Adds one value.
+     */
+    void insert(const T& value) {
+        if (lower.empty() || !(*lower.rbegin() < value)) lower.insert(value);
+        else upper.insert(value);
+        rebalance();
+    }
+
+    /**
+     * @brief Removes every copy of a value.
+     * @return Number of copies removed.
+     */
+    size_t eraseAll(const T& value) {
+        size_t removed = lower.erase(value) + upper.erase(value);
+        if (removed) rebalance();
+        return removed;
+    }
+
+    /**
+     * @brief Removes one copy of a value, if present.
+     * @return True if a copy was removed.
+     */
+    bool eraseOne(const T& value) {
+        auto it = lower.find(value);
+        if (it != lower.end()) {
+            lower.erase(it);
+        } else {
+            it = upper.find(value);
+            if (it == upper.end()) return false;
+            upper.erase(it);
+        }
+        rebalance();
+        return true;
+    }
+
+    /**
+     * @brief Replaces the tracked values with [first, last).
+     */
+    template<typename It>
+    void assign(It first, It last) {
+        lower.clear();
+        upper.clear();
+        for (; first != last; ++first) insert(*first);
+    }
+
+    size_t size() const { return lower.size() + upper.size(); }
+
+    /**
+     * @throws std::runtime_error If no values are tracked.
+     */
+    const T& min() const { requireNonEmpty(); return *lower.begin(); }
+
+    /**
+     * @throws std::runtime_error If no values are tracked.
+     */
+    const T& max() const { requireNonEmpty(); return upper.empty() ? *lower.rbegin() : *upper.rbegin(); }
+
+    /**
+     * @brief Lower median: the value at sorted position (n - 1) / 2.
+     * @throws std::runtime_error If no values are tracked.
+     */
+    const T& median() const { requireNonEmpty(); return *lower.rbegin(); }
+};
+
+} // namespace my_container_project
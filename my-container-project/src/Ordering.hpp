@@ -0,0 +1,126 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace my_container_project {
+namespace ordering {
+
+/**
+ * @brief Projection returning its argument unchanged (std::identity before C++20).
+ */
+struct Identity {
+    template<typename U>
+    constexpr U&& operator()(U&& value) const noexcept { return std::forward<U>(value); }
+};
+
+/// Below this size the key pairs are sorted with std::stable_sort instead of radix passes.
+constexpr size_t kRadixThreshold = 256;
+
+/**
+ * @brief +1 if Compare is std::less on Key, -1 if std::greater, 0 otherwise.
+ * Only these comparators are known to order arithmetic keys by value, which
+ * is what the key-extraction and radix paths assume.
+ */
+template<typename Compare, typename Key>
+constexpr int keyDirection() {
+    if (std::is_same<Compare, std::less<>>::value || std::is_same<Compare, std::less<Key>>::value) return 1;
+    if (std::is_same<Compare, std::greater<>>::value || std::is_same<Compare, std::greater<Key>>::value) return -1;
+    return 0;
+}
+
+/**
+ * @brief Maps an integral key to an unsigned key with the same order.
+ */
+template<typename Key>
+typename std::make_unsigned<Key>::type radixKey(Key key) {
+    using U = typename std::make_unsigned<Key>::type;
+    U u = static_cast<U>(key);
+    if (std::is_signed<Key>::value) u ^= static_cast<U>(U(1) << (sizeof(U) * 8 - 1));
+    return u;
+}
+
+/**
+ * @brief Stable LSD radix sort of (unsigned key, position) pairs, 8 bits per pass.
+ * Passes whose digit is the same for every key are skipped.
+ */
+template<typename PairVec>
+void radixSort(PairVec& pairs, PairVec& scratch) {
+    using UKey = typename PairVec::value_type::first_type;
+    scratch.resize(pairs.size());
+    for (unsigned shift = 0; shift < sizeof(UKey) * 8; shift += 8) {
+        std::array<size_t, 256> start{};
+        for (const auto& p : pairs) ++start[(p.first >> shift) & 0xFF];
+        if (start[(pairs[0].first >> shift) & 0xFF] == pairs.size()) continue;
+        size_t sum = 0;
+        for (size_t& s : start) {
+            size_t c = s;
+            s = sum;
+            sum += c;
+        }
+        for (const auto& p : pairs) scratch[start[(p.first >> shift) & 0xFF]++] = p;
+        pairs.swap(scratch);
+    }
+}
+
+/**
+ * @brief Fills index with the positions of elements, stably ordered by
+ *        comp(proj(a), proj(b)).
+ *
+ * When the projected key is arithmetic and comp is std::less or std::greater,
+ * keys are extracted once into (key, position) pairs so sorting never calls
+ * the projection or touches the elements again; integral keys are then radix
+ * sorted. Any other comparator sorts positions with std::stable_sort.
+ * Temporaries use index's allocator.
+ */
+template<typename Storage, typename IndexVec, typename Compare, typename Projection>
+void sortPermutation(const Storage& elements, IndexVec& index, Compare comp, Projection proj) {
+    using Value = typename Storage::value_type;
+    using Key = typename std::decay<typename std::invoke_result<Projection&, const Value&>::type>::type;
+    constexpr int direction = keyDirection<Compare, Key>();
+
+    const size_t n = elements.size();
+    index.resize(n);
+    for (size_t i = 0; i < n; ++i) index[i] = i;
+    if (n < 2) return;
+
+    if constexpr (std::is_arithmetic<Key>::value && direction != 0) {
+        using Alloc = typename std::allocator_traits<typename IndexVec::allocator_type>::template rebind_alloc<std::pair<Key, size_t>>;
+        constexpr bool radix = std::is_integral<Key>::value && !std::is_same<Key, bool>::value;
+        if constexpr (radix) {
+            using UKey = typename std::make_unsigned<Key>::type;
+            using URebind = typename std::allocator_traits<typename IndexVec::allocator_type>::template rebind_alloc<std::pair<UKey, size_t>>;
+            if (n >= kRadixThreshold) {
+                std::vector<std::pair<UKey, size_t>, URebind> pairs{URebind(index.get_allocator())};
+                std::vector<std::pair<UKey, size_t>, URebind> scratch{URebind(index.get_allocator())};
+                pairs.reserve(n);
+                for (size_t i = 0; i < n; ++i) {
+                    UKey k = radixKey(static_cast<Key>(std::invoke(proj, elements[i])));
+                    pairs.emplace_back(direction > 0 ? k : static_cast<UKey>(~k), i);
+                }
+                radixSort(pairs, scratch);
+                for (size_t i = 0; i < n; ++i) index[i] = pairs[i].second;
+                return;
+            }
+        }
+        std::vector<std::pair<Key, size_t>, Alloc> pairs{Alloc(index.get_allocator())};
+        pairs.reserve(n);
+        for (size_t i = 0; i < n; ++i) pairs.emplace_back(std::invoke(proj, elements[i]), i);
+        std::stable_sort(pairs.begin(), pairs.end(), [&comp](const auto& a, const auto& b) {
+            return std::invoke(comp, a.first, b.first);
+        });
+        for (size_t i = 0; i < n; ++i) index[i] = pairs[i].second;
+    } else {
+        std::stable_sort(index.begin(), index.end(), [&](size_t a, size_t b) {
+            return std::invoke(comp, std::invoke(proj, elements[a]), std::invoke(proj, elements[b]));
+        });
+    }
+}
+
+} // namespace ordering
+} // namespace my_container_project
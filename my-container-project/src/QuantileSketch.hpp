@@ -0,0 +1,201 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace my_container_project {
+
+/**
+ * @brief KLL streaming quantile sketch (Karnin, Lang, Liberty 2016).
+ *
+ * Values enter level 0. When the sketch exceeds its capacity, the first full
+ * level is sorted and every other value (from a random offset) is promoted
+ * to the next level with twice the weight. Level h holds about
+ * k * (2/3)^(levels-1-h) values, so the sketch keeps O(k) values whatever
+ * the stream length. Sketches with the same k can be merged, e.g. across
+ * shards. The random offsets come from a seeded generator, so the same input
+ * and seed always give the same sketch.
+ * @tparam T Element type with operator<
+ * @tparam Allocator Allocator for the retained values
+ */
+template<typename T, typename Allocator = std::allocator<T>>
+class KllSketch {
+public:
+    static constexpr size_t kDefaultK = 200;
+    static constexpr uint64_t kDefaultSeed = 0x9E3779B97F4A7C15ull;
+
+private:
+    using Level = std::vector<T, Allocator>;
+    using Levels = std::vector<Level, typename std::allocator_traits<Allocator>::template rebind_alloc<Level>>;
+
+    size_t k;
+    uint64_t seed;
+    uint64_t rngState;
+    uint64_t count = 0;
+    size_t retained = 0;
+    size_t maxRetained = 0;
+    Levels levels;
+    std::vector<size_t> capacities; // Per level; recomputed when a level is added
+
+    bool randomBit() { // splitmix64
+        uint64_t z = (rngState += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return ((z ^ (z >> 31)) & 1) != 0;
+    }
+
+    size_t capacity(size_t h) const { return capacities[h]; }
+
+    void grow() {
+        levels.push_back(Level(Allocator(levels.get_allocator())));
+        capacities.resize(levels.size());
+        maxRetained = 0;
+        for (size_t h = 0; h < levels.size(); ++h) {
+            double depth = static_cast<double>(levels.size() - 1 - h);
+            capacities[h] = static_cast<size_t>(std::ceil(static_cast<double>(k) * std::pow(2.0 / 3.0, depth))) + 1;
+            maxRetained += capacities[h];
+        }
+    }
+
+    /**
+     * @brief Compacts full levels until the sketch is within capacity.
+     */
+    void compress() {
+        for (size_t h = 0; h < levels.size() && retained >= maxRetained; ++h) {
+            if (levels[h].size() < capacity(h)) continue;
+            if (h + 1 == levels.size()) grow();
+            Level& level = levels[h];
+            std::sort(level.begin(), level.end());
+            const bool odd = level.size() % 2 == 1;
+            const size_t pairs = level.size() / 2;
+            const size_t offset = randomBit() ? 1 : 0;
+            for (size_t i = 0; i < pairs; ++i) levels[h + 1].push_back(level[2 * i + offset]);
+            if (odd) {
+                T leftover = level.back();
+                level.clear();
+                level.push_back(leftover);
+            } else {
+                level.clear();
+            }
+            retained -= pairs;
+        }
+    }
+
+    /**
+     * @brief Retained values with their weights, sorted by value.
+     */
+    std::vector<std::pair<T, uint64_t>> weighted() const {
+        std::vector<std::pair<T, uint64_t>> items;
+        items.reserve(retained);
+        for (size_t h = 0; h < levels.size(); ++h)
+            for (const T& v : levels[h]) items.emplace_back(v, uint64_t(1) << h);
+        std::sort(items.begin(), items.end(),
+                  [](const std::pair<T, uint64_t>& a, const std::pair<T, uint64_t>& b) { return a.first < b.first; });
+        return items;
+    }
+
+public:
+    /**
+     * @brief Constructs an empty sketch.
+     * @param accuracy Parameter k; rank error shrinks roughly as 1/k.
+     * @param randomSeed Seed for the compaction offsets.
+     * @param alloc Allocator for the retained values.
+     * @throws std::invalid_argument If accuracy is below 8.
+     */
+    explicit KllSketch(size_t accuracy = kDefaultK, uint64_t randomSeed = kDefaultSeed, const Allocator& alloc = Allocator())
+        : k(accuracy), seed(randomSeed), rngState(randomSeed), levels(alloc) {
+        if (k < 8) throw std::invalid_argument("KllSketch needs k >= 8");
+        grow();
+    }
+
+    /**
+     * @brief Adds a value to the stream.
+     */
+    void update(const T& value) {
+        levels[0].push_back(value);
+        ++count;
+        if (++retained >= maxRetained) compress();
+    }
+
+    /**
+     * @brief Folds another sketch (same k) into this one, as if its stream were appended.
+     * @throws std::invalid_argument If the sketches use different k.
+     */
+    void merge(const KllSketch& other) {
+        if (other.k != k) throw std::invalid_argument("Cannot merge KLL sketches with different k");
+        while (levels.size() < other.levels.size()) grow();
+        for (size_t h = 0; h < other.levels.size(); ++h)
+            levels[h].insert(levels[h].end(), other.levels[h].begin(), other.levels[h].end());
+        count += other.count;
+        retained += other.retained;
+        while (retained >= maxRetained) compress();
+    }
+
+    /**
+     * @brief Drops all values and restarts the random sequence from the seed.
+     */
+    void clear() {
+        levels.clear();
+        count = 0;
+        retained = 0;
+        rngState = seed;
+        grow();
+    }
+
+    /**
+     * @brief Approximate value at normalized rank q (0 = min, 0.5 = median, 1 = max).
+     * @throws std::invalid_argument If q is outside [0, 1].
+     * @throws std::runtime_error If the sketch is empty.
+     */
+    T quantile(double q) const {
+        if (!(q >= 0.0 && q <= 1.0)) throw std::invalid_argument("Quantile must be in [0, 1]");
+        if (count == 0) throw std::runtime_error("Container is empty");
+        std::vector<std::pair<T, uint64_t>> items = weighted();
+        const double target = q * static_cast<double>(count);
+        uint64_t cumulative = 0;
+        for (const auto& item : items) {
+            cumulative += item.second;
+            if (static_cast<double>(cumulative) >= target) return item.first;
+        }
+        return items.back().first;
+    }
+
+    /**
+     * @brief Approximate fraction of the stream that is <= value.
+     * @throws std::runtime_error If the sketch is empty.
+     */
+    double rank(const T& value) const {
+        if (count == 0) throw std::runtime_error("Container is empty");
+        uint64_t below = 0;
+        for (size_t h = 0; h < levels.size(); ++h)
+            for (const T& v : levels[h])
+                if (!(value < v)) below += uint64_t(1) << h;
+        return static_cast<double>(below) / static_cast<double>(count);
+    }
+
+    /**
+     * @brief Typical (99% confidence) rank error for this k, from the DataSketches KLL fit 2.296 / k^0.9723.
+     */
+    double normalizedRankError() const { return 2.296 / std::pow(static_cast<double>(k), 0.9723); }
+
+    /**
+     * @brief Number of values added to the stream.
+     */
+    uint64_t size() const { return count; }
+
+    /**
+     * @brief Number of values currently retained by the sketch.
+     */
+    size_t retainedCount() const { return retained; }
+
+    /**
+     * @brief Accuracy parameter k.
+     */
+    size_t accuracy() const { return k; }
+};
+
+} // namespace my_container_project
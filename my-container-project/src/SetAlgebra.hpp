@@ -0,0 +1,170 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include "Aggregates.hpp"
+
+namespace my_container_project {
+namespace set_algebra {
+
+using aggregates::Gather;
+using aggregates::Span;
+
+/**
+ * @brief Which parts of two sorted inputs an operation emits, as bit flags:
+ *        values only in a, values only in b, and values in both (taken from a).
+ */
+enum Part : unsigned { kOnlyA = 1, kOnlyB = 2, kBoth = 4 };
+
+constexpr unsigned kUnion = kOnlyA | kOnlyB | kBoth;
+constexpr unsigned kIntersection = kBoth;
+constexpr unsigned kDifference = kOnlyA;
+constexpr unsigned kSymmetricDifference = kOnlyA | kOnlyB;
+
+/// Size ratio from which the smaller input is galloped through the larger one.
+constexpr size_t kGallopRatio = 32;
+
+/**
+ * @brief True if one input is so much smaller that galloping beats a linear merge.
+ */
+inline bool isSkewed(size_t na, size_t nb) { return na * kGallopRatio <= nb || nb * kGallopRatio <= na; }
+
+template<typename T>
+const T& at(const Span<T>& s, size_t i) { return s.data[i]; }
+
+template<typename T>
+const T& at(const Gather<T>& g, size_t i) { return g.base[g.index[i]]; }
+
+/**
+ * @brief First position p >= from with !(r[p] < value): probes from+1, +2, +4, ...
+ *        then binary searches the last gap, so the cost is O(log distance).
+ */
+template<typename R, typename T>
+size_t gallop(const R& r, size_t from, const T& value) {
+    size_t bound = 1;
+    while (from + bound <= r.size && at(r, from + bound - 1) < value) bound <<= 1;
+    size_t lo = from + bound / 2;
+    size_t hi = std::min(from + bound - 1, r.size);
+    while (lo < hi) {
+        const size_t mid = lo + (hi - lo) / 2;
+        if (at(r, mid) < value) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+/**
+ * @brief Merges two ascending inputs in one pass. Each step compares once in
+ *        each direction and advances both cursors arithmetically, so the only
+ *        data-dependent branch left is whether to emit.
+ */
+template<unsigned Ops, typename A, typename B, typename Sink>
+void linearMerge(const A& a, const B& b, Sink& sink) {
+    size_t i = 0, j = 0;
+    while (i < a.size && j < b.size) {
+        const auto& x = at(a, i);
+        const auto& y = at(b, j);
+        const bool lt = x < y, gt = y < x;
+        if (lt ? (Ops & kOnlyA) != 0 : gt ? (Ops & kOnlyB) != 0 : (Ops & kBoth) != 0) sink(gt ? y : x);
+        i += !gt;
+        j += !lt;
+    }
+    if constexpr ((Ops & kOnlyA) != 0) for (; i < a.size; ++i) sink(at(a, i));
+    if constexpr ((Ops & kOnlyB) != 0) for (; j < b.size; ++j) sink(at(b, j));
+}
+
+/**
+ * @brief Merges a small input into a much larger one by galloping: each value
+ *        of the small input finds its place in O(log gap), and runs of the
+ *        large input between matches are emitted (or skipped) wholesale.
+ * @tparam SmallIsA True if the small input is the first operand.
+ */
+template<unsigned Ops, bool SmallIsA, typename S, typename L, typename Sink>
+void gallopingMerge(const S& small, const L& large, Sink& sink) {
+    constexpr bool emitLarge = (Ops & (SmallIsA ? kOnlyB : kOnlyA)) != 0;
+    constexpr bool emitSmall = (Ops & (SmallIsA ? kOnlyA : kOnlyB)) != 0;
+    constexpr bool emitBoth = (Ops & kBoth) != 0;
+    size_t p = 0;
+    for (size_t k = 0; k < small.size; ++k) {
+        const auto& s = at(small, k);
+        const size_t q = gallop(large, p, s);
+        if constexpr (emitLarge) for (; p < q; ++p) sink(at(large, p));
+        p = q;
+        if (p < large.size && !(s < at(large, p))) {
+            if constexpr (emitBoth) sink(SmallIsA ? s : at(large, p));
+            ++p;
+        } else if constexpr (emitSmall) {
+            sink(s);
+        }
+    }
+    if constexpr (emitLarge) for (; p < large.size; ++p) sink(at(large, p));
+}
+
+/**
+ * @brief Combines two ascending inputs with multiset semantics, like the
+ *        std::set_* algorithms: a value occurring m times in a and n times in
+ *        b occurs min(m, n) times in the intersection, max(m, n) times in the
+ *        union, m - n times in the difference and |m - n| times in the
+ *        symmetric difference. Output is ascending; sink(value) is called once
+ *        per output value.
+ * @tparam Ops kUnion, kIntersection, kDifference or kSymmetricDifference.
+ */
+template<unsigned Ops, typename A, typename B, typename Sink>
+void combine(const A& a, const B& b, Sink&& sink) {
+    if (a.size * kGallopRatio <= b.size) gallopingMerge<Ops, true>(a, b, sink);
+    else if (b.size * kGallopRatio <= a.size) gallopingMerge<Ops, false>(b, a, sink);
+    else linearMerge<Ops>(a, b, sink);
+}
+
+#if defined(MY_CONTAINER_AGGREGATES_X86)
+namespace detail {
+
+/**
+ * @brief SSE2 intersection of two strictly ascending 32-bit arrays
+ *        (Schlegel, Willhalm, Lehner 2011): each step compares a block of four
+ *        values of a with all four rotations of a block of b, then advances
+ *        the block with the smaller last value (or both).
+ */
+template<typename T, typename Sink>
+void intersectDistinctSse2(const T* a, size_t na, const T* b, size_t nb, Sink& sink) {
+    size_t i = 0, j = 0;
+    while (i + 4 <= na && j + 4 <= nb) {
+        const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + j));
+        const __m128i eq = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi32(va, vb), _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1)))),
+            _mm_or_si128(_mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(1, 0, 3, 2))),
+                         _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(2, 1, 0, 3)))));
+        for (int mask = _mm_movemask_ps(_mm_castsi128_ps(eq)); mask != 0; mask &= mask - 1)
+            sink(a[i + static_cast<size_t>(__builtin_ctz(static_cast<unsigned>(mask)))]);
+        const T lastA = a[i + 3], lastB = b[j + 3];
+        i += lastA <= lastB ? 4 : 0;
+        j += lastB <= lastA ? 4 : 0;
+    }
+    linearMerge<kIntersection>(Span<T>{a + i, na - i}, Span<T>{b + j, nb - j}, sink);
+}
+
+} // namespace detail
+#endif
+
+/**
+ * @brief Intersection of two strictly ascending contiguous inputs (no
+ *        duplicates within either). 32-bit integers use the SSE2 block
+ *        kernel when available; galloping still applies to skewed sizes.
+ */
+template<typename T, typename Sink>
+void intersectDistinct(const Span<T>& a, const Span<T>& b, Sink&& sink) {
+#if defined(MY_CONTAINER_AGGREGATES_X86)
+    if constexpr (std::is_integral<T>::value && sizeof(T) == 4) {
+        if (aggregates::activeIsa() != aggregates::Isa::Scalar && !isSkewed(a.size, b.size)) {
+            detail::intersectDistinctSse2(a.data, a.size, b.data, b.size, sink);
+            return;
+        }
+    }
+#endif
+    combine<kIntersection>(a, b, sink);
+}
+
+} // namespace set_algebra
+} // namespace my_container_project
@@ -0,0 +1,182 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace my_container_project {
+
+/**
+ * @brief True if std::hash<T> is enabled, i.e. T can be used with the sketches below.
+ */
+template<typename T>
+constexpr bool isHashable = std::is_default_constructible<std::hash<T>>::value;
+
+/**
+ * @brief 64-bit hash of a value: std::hash followed by the splitmix64 finalizer.
+ * std::hash is the identity for integers in common standard libraries; the
+ * finalizer spreads every input bit over the whole word, which both sketches
+ * below rely on.
+ */
+template<typename T>
+uint64_t sketchHash(const T& value) {
+    uint64_t z = static_cast<uint64_t>(std::hash<T>()(value)) + 0x9E3779B97F4A7C15ull;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+/**
+ * @brief Number of leading zero bits of a non-zero word.
+ */
+inline unsigned leadingZeros(uint64_t x) {
+#if defined(__GNUC__)
+    return static_cast<unsigned>(__builtin_clzll(x));
+#else
+    unsigned n = 0;
+    while (!(x & (uint64_t(1) << 63))) { x <<= 1; ++n; }
+    return n;
+#endif
+}
+
+/**
+ * @brief Bloom filter: set membership with no false negatives.
+ *
+ * Sized for an expected number of items and false-positive rate; the bit
+ * count is rounded up to a power of two and the probe positions come from
+ * double hashing of one 64-bit hash. Items cannot be deleted.
+ * @tparam T Element type supported by std::hash
+ * @tparam Allocator Allocator rebound for the bit words
+ */
+template<typename T, typename Allocator = std::allocator<T>>
+class BloomFilter {
+private:
+    std::vector<uint64_t, typename std::allocator_traits<Allocator>::template rebind_alloc<uint64_t>> words;
+    uint64_t mask = 0;    // Bit count - 1
+    unsigned probes = 1;
+    size_t expected = 0;
+
+public:
+    /**
+     * @brief Constructs an empty filter.
+     * @param expectedItems Number of items the false-positive rate is designed for.
+     * @param falsePositiveRate Target probability that mightContain() is wrongly true.
+     * @param alloc Allocator for the bit words.
+     * @throws std::invalid_argument If the rate is not in (0, 1).
+     */
+    explicit BloomFilter(size_t expectedItems = 1024, double falsePositiveRate = 0.01, const Allocator& alloc = Allocator())
+        : words(alloc), expected(std::max<size_t>(expectedItems, 1)) {
+        if (!(falsePositiveRate > 0.0 && falsePositiveRate < 1.0))
+            throw std::invalid_argument("Bloom filter false-positive rate must be in (0, 1)");
+        const double ln2 = std::log(2.0);
+        const double bits = -static_cast<double>(expected) * std::log(falsePositiveRate) / (ln2 * ln2);
+        uint64_t m = 64;
+        while (static_cast<double>(m) < bits) m <<= 1;
+        mask = m - 1;
+        probes = static_cast<unsigned>(std::max(1.0, std::round(static_cast<double>(m) / expected * ln2)));
+        words.assign(m / 64, 0);
+    }
+
+    void insert(const T& value) {
+        const uint64_t h = sketchHash(value);
+        const uint64_t step = (h >> 32) | 1;
+        uint64_t pos = h;
+        for (unsigned i = 0; i < probes; ++i, pos += step) words[(pos & mask) >> 6] |= uint64_t(1) << (pos & 63);
+    }
+
+    /**
+     * @brief False means the value was never inserted; true means it probably was.
+     */
+    bool mightContain(const T& value) const {
+        const uint64_t h = sketchHash(value);
+        const uint64_t step = (h >> 32) | 1;
+        uint64_t pos = h;
+        for (unsigned i = 0; i < probes; ++i, pos += step)
+            if (!(words[(pos & mask) >> 6] & (uint64_t(1) << (pos & 63)))) return false;
+        return true;
+    }
+
+    void clear() { std::fill(words.begin(), words.end(), 0); }
+
+    size_t expectedItems() const { return expected; }
+    unsigned probeCount() const { return probes; }
+    size_t memoryUsage() const { return words.size() * sizeof(uint64_t); }
+};
+
+/**
+ * @brief HyperLogLog distinct-count estimator (Flajolet et al. 2007).
+ *
+ * 2^precision one-byte registers each keep the longest run of leading zeros
+ * seen among the hashes routed to them. The standard error is about
+ * 1.04 / sqrt(2^precision) (0.8% at precision 14, using 16 KiB). Small
+ * cardinalities use linear counting. Estimators with the same precision merge
+ * by taking register-wise maxima. Items cannot be deleted.
+ * @tparam T Element type supported by std::hash
+ * @tparam Allocator Allocator rebound for the registers
+ */
+template<typename T, typename Allocator = std::allocator<T>>
+class HyperLogLog {
+private:
+    std::vector<uint8_t, typename std::allocator_traits<Allocator>::template rebind_alloc<uint8_t>> registers;
+    unsigned precision;
+
+public:
+    static constexpr unsigned kDefaultPrecision = 14;
+
+    /**
+     * @brief Constructs an empty estimator.
+     * @param bits Precision p; uses 2^p registers.
+     * @param alloc Allocator for the registers.
+     * @throws std::invalid_argument If p is outside [4, 18].
+     */
+    explicit HyperLogLog(unsigned bits = kDefaultPrecision, const Allocator& alloc = Allocator())
+        : registers(alloc), precision(bits) {
+        if (bits < 4 || bits > 18) throw std::invalid_argument("HyperLogLog precision must be in [4, 18]");
+        registers.assign(size_t(1) << precision, 0);
+    }
+
+    void insert(const T& value) {
+        const uint64_t h = sketchHash(value);
+        const size_t idx = static_cast<size_t>(h >> (64 - precision));
+        const uint64_t rest = (h << precision) | (uint64_t(1) << (precision - 1)); // Sentinel bounds the run
+        const uint8_t rank = static_cast<uint8_t>(leadingZeros(rest) + 1);
+        if (rank > registers[idx]) registers[idx] = rank;
+    }
+
+    /**
+     * @brief Folds another estimator (same precision) into this one.
+     * @throws std::invalid_argument If the precisions differ.
+     */
+    void merge(const HyperLogLog& other) {
+        if (other.precision != precision) throw std::invalid_argument("Cannot merge HyperLogLogs with different precision");
+        for (size_t i = 0; i < registers.size(); ++i) registers[i] = std::max(registers[i], other.registers[i]);
+    }
+
+    /**
+     * @brief Estimated number of distinct values inserted.
+     */
+    double estimate() const {
+        const double m = static_cast<double>(registers.size());
+        double harmonic = 0;
+        size_t zeros = 0;
+        for (uint8_t r : registers) {
+            harmonic += std::ldexp(1.0, -static_cast<int>(r));
+            if (r == 0) ++zeros;
+        }
+        const double alpha = 0.7213 / (1.0 + 1.079 / m);
+        const double raw = alpha * m * m / harmonic;
+        if (raw <= 2.5 * m && zeros > 0) return m * std::log(m / static_cast<double>(zeros));
+        return raw;
+    }
+
+    void clear() { std::fill(registers.begin(), registers.end(), 0); }
+
+    unsigned precisionBits() const { return precision; }
+    size_t memoryUsage() const { return registers.size(); }
+};
+
+} // namespace my_container_project
@@ -0,0 +1,283 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace my_container_project {
+
+/**
+ * @brief Orders x and y so that !(y < x). Arithmetic types take both
+ *        outcomes as a min/max pair of selects (cmov/minss), with no branch
+ *        on the data; other types swap conditionally.
+ */
+template<typename T>
+void compareExchange(T& x, T& y) {
+    if constexpr (std::is_arithmetic<T>::value) {
+        const bool greater = y < x;
+        const T lo = greater ? y : x;
+        const T hi = greater ? x : y;
+        x = lo;
+        y = hi;
+    } else if (y < x) {
+        std::swap(x, y);
+    }
+}
+
+/**
+ * @brief Sorts a[0..n) with Batcher's merge-exchange sorting network
+ *        (Knuth, TAOCP 5.2.2, Algorithm M).
+ * The sequence of compare-exchanges depends only on n, so the only branches
+ * left are on loop indices once compareExchange() is branch-free (arithmetic
+ * types). Works in place on a stack buffer.
+ */
+template<typename T>
+void sortingNetwork(T* a, size_t n) {
+    if (n < 2) return;
+    size_t t = 0;
+    while ((size_t(1) << t) < n) ++t;
+    for (size_t p = size_t(1) << (t - 1); p > 0; p >>= 1) {
+        size_t q = size_t(1) << (t - 1), r = 0, d = p;
+        for (;;) {
+            for (size_t i = 0; i + d < n; ++i) {
+                if ((i & p) == r) compareExchange(a[i], a[i + d]);
+            }
+            if (q == p) break;
+            d = q - p;
+            q >>= 1;
+            r = p;
+        }
+    }
+}
+
+/**
+ * @brief Container keeping up to N elements inline, without heap allocation.
+ *
+ * Beyond N elements storage moves to a std::vector. Views of containers that
+ * are still inline copy into stack arrays and sort with a sorting network, so
+ * a small container is built and traversed in every order with zero heap
+ * allocations.
+ * @tparam T Default-constructible element type (default: int)
+ * @tparam N Inline capacity (default: 16)
+ */
+template<typename T = int, size_t N = 16>
+class SmallMyContainer {
+    static_assert(N > 0, "SmallMyContainer needs a non-zero inline capacity");
+private:
+    std::array<T, N> inlineElements{};
+    size_t inlineCount = 0;
+    std::vector<T> heapElements;
+    bool onHeap = false;
+
+    const T* data() const { return onHeap ? heapElements.data() : inlineElements.data(); }
+
+    /**
+     * @brief Iterator over a contiguous buffer, forward or backward.
+     * Backward iterators count down and read base[pos - 1], so no pointer
+     * ever points before the buffer.
+     */
+    class PointerIterator {
+    private:
+        const T* base;
+        size_t pos;
+        bool reverse;
+    public:
+        PointerIterator(const T* b, size_t p, bool rev) : base(b), pos(p), reverse(rev) {}
+
+        const T& operator*() const { return reverse ? base[pos - 1] : base[pos]; }
+
+        PointerIterator& operator++() { if (reverse) --pos; else ++pos; return *this; } // Prefix increment
+
+        PointerIterator operator++(int) { PointerIterator temp = *this; ++(*this); return temp; } // Postfix increment
+
+        bool operator!=(const PointerIterator& other) const { return pos != other.pos || base != other.base; }
+
+        bool operator==(const PointerIterator& other) const { return !(*this != other); }
+    };
+
+    /**
+     * @brief View buffer: a stack array while the container is inline, a vector otherwise.
+     */
+    class ViewBuffer {
+    protected:
+        std::array<T, N> stackBuffer;
+        std::vector<T> heapBuffer;
+        T* buffer;
+        size_t count;
+
+        explicit ViewBuffer(size_t n) : count(n) {
+            if (n > N) {
+                heapBuffer.resize(n);
+                buffer = heapBuffer.data();
+            } else {
+                buffer = stackBuffer.data();
+            }
+        }
+
+        ViewBuffer(const ViewBuffer&) = delete;
+        ViewBuffer& operator=(const ViewBuffer&) = delete;
+
+        /**
+         * @brief Fills the buffer with the container's elements sorted ascending.
+         */
+        void fillSorted(const SmallMyContainer& c) {
+            std::copy(c.data(), c.data() + count, buffer);
+            if (count <= N) sortingNetwork(buffer, count);
+            else std::sort(buffer, buffer + count);
+        }
+    };
+
+    /**
+     * @brief View iterating its buffer front to back.
+     */
+    class ForwardView : public ViewBuffer {
+    protected:
+        using ViewBuffer::ViewBuffer;
+    public:
+        using Iterator = PointerIterator;
+        Iterator begin() const { return Iterator(this->buffer, 0, false); }
+        Iterator end() const { return Iterator(this->buffer, this->count, false); }
+    };
+
+public:
+    SmallMyContainer() = default;
+
+    /**
+     * @brief Adds an element, moving storage to the heap once N is exceeded.
+     * @param element The element to add.
+     */
+    void addElement(const T& element) {
+        if (!onHeap && inlineCount < N) {
+            inlineElements[inlineCount++] = element;
+            return;
+        }
+        if (!onHeap) {
+            heapElements.reserve(2 * N);
+            heapElements.assign(inlineElements.begin(), inlineElements.begin() + inlineCount);
+            onHeap = true;
+        }
+        heapElements.push_back(element);
+    }
+
+    /**
+     * @brief Removes all occurrences of an element.
+     * @param element The element to remove.
+     * @throws std::runtime_error If the element is not found.
+     */
+    void remove(const T& element) {
+        if (onHeap) {
+            auto it = std::remove(heapElements.begin(), heapElements.end(), element);
+            if (it == heapElements.end())
+                throw std::runtime_error("Element not found in container");
+            heapElements.erase(it, heapElements.end());
+        } else {
+            auto last = inlineElements.begin() + inlineCount;
+            auto it = std::remove(inlineElements.begin(), last, element);
+            if (it == last)
+                throw std::runtime_error("Element not found in container");
+            inlineCount = static_cast<size_t>(it - inlineElements.begin());
+        }
+    }
+
+    /**
+     * @brief Returns the number of elements in the container.
+     */
+    size_t size() const { return onHeap ? heapElements.size() : inlineCount; }
+
+    /**
+     * @brief True while the elements are stored inline (no heap allocation).
+     */
+    bool isInline() const { return !onHeap; }
+
+    /**
+     * @brief Original order iterator (in insertion order); no copy.
+     */
+    class Order {
+    private:
+        const SmallMyContainer& owner;
+    public:
+        Order(const SmallMyContainer& c) : owner(c) {}
+        PointerIterator begin() const { return PointerIterator(owner.data(), 0, false); }
+        PointerIterator end() const { return PointerIterator(owner.data(), owner.size(), false); }
+    };
+
+    /**
+     * @brief Reverse order iterator (original insertion order, reversed); no copy.
+     */
+    class ReverseOrder {
+    private:
+        const SmallMyContainer& owner;
+    public:
+        ReverseOrder(const SmallMyContainer& c) : owner(c) {}
+        PointerIterator begin() const { return PointerIterator(owner.data(), owner.size(), true); }
+        PointerIterator end() const { return PointerIterator(owner.data(), 0, true); }
+    };
+
+    /**
+     * @brief Ascending order, sorted in a stack buffer while inline.
+     */
+    class AscendingOrder : public ForwardView {
+    public:
+        AscendingOrder(const SmallMyContainer& c) : ForwardView(c.size()) { this->fillSorted(c); }
+    };
+
+    /**
+     * @brief Descending order, sorted in a stack buffer while inline.
+     */
+    class DescendingOrder : public ViewBuffer {
+    public:
+        DescendingOrder(const SmallMyContainer& c) : ViewBuffer(c.size()) { this->fillSorted(c); }
+
+        using Iterator = PointerIterator;
+        Iterator begin() const { return Iterator(this->buffer, this->count, true); }
+        Iterator end() const { return Iterator(this->buffer, 0, true); }
+    };
+
+    /**
+     * @brief Side-cross order: smallest, largest, second smallest, ...
+     */
+    class SideCrossOrder : public ForwardView {
+    public:
+        SideCrossOrder(const SmallMyContainer& c) : ForwardView(c.size()) {
+            this->fillSorted(c);
+            std::array<T, N> stackSorted;
+            std::vector<T> heapSorted;
+            T* sorted = stackSorted.data();
+            if (this->count > N) {
+                heapSorted.assign(this->buffer, this->buffer + this->count);
+                sorted = heapSorted.data();
+            } else {
+                std::copy(this->buffer, this->buffer + this->count, sorted);
+            }
+            size_t left = 0, right = this->count, out = 0;
+            while (left < right) {
+                this->buffer[out++] = sorted[left++];
+                if (left < right) this->buffer[out++] = sorted[--right];
+            }
+        }
+    };
+
+    /**
+     * @brief Middle-out order: middle (rounded down), then alternately left and right.
+     */
+    class MiddleOutOrder : public ForwardView {
+    public:
+        MiddleOutOrder(const SmallMyContainer& c) : ForwardView(c.size()) {
+            size_t n = this->count;
+            if (n == 0) return;
+            const T* src = c.data();
+            size_t mid = (n % 2 == 0) ? (n / 2 - 1) : (n / 2);
+            size_t out = 0;
+            this->buffer[out++] = src[mid];
+            for (size_t step = 1; step <= mid || mid + step < n; ++step) {
+                if (step <= mid) this->buffer[out++] = src[mid - step];
+                if (mid + step < n) this->buffer[out++] = src[mid + step];
+            }
+        }
+    };
+};
+
+} // namespace my_container_project
@@ -0,0 +1,227 @@
+#pragma once
+#include <cstddef>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Ordering.hpp"
+
+namespace my_container_project {
+
+namespace soa_detail {
+
+template<typename M>
+struct MemberTraits;
+
+template<typename Class, typename Value>
+struct MemberTraits<Value Class::*> {
+    using class_type = Class;
+    using value_type = Value;
+};
+
+} // namespace soa_detail
+
+/**
+ * @brief Structure-of-arrays container for aggregate elements.
+ *
+ * Each listed data member is stored in its own contiguous column, e.g.
+ * `SoAMyContainer<Reading, &Reading::timestamp, &Reading::id, &Reading::value>`.
+ * Sorted views sort only the key column plus a permutation, and iteration
+ * yields RowRef proxies that read columns on demand, so a scan of one field
+ * only touches that field's column.
+ * @tparam T Default-constructible aggregate element type
+ * @tparam Members Pointers to the data members of T to store, one column each
+ */
+template<typename T, auto... Members>
+class SoAMyContainer {
+    static_assert(sizeof...(Members) > 0, "SoAMyContainer needs at least one member column");
+    static_assert((std::is_same<typename soa_detail::MemberTraits<decltype(Members)>::class_type, T>::value && ...),
+                  "SoAMyContainer columns must be data members of T");
+    static_assert((!std::is_same<typename soa_detail::MemberTraits<decltype(Members)>::value_type, bool>::value && ...),
+                  "SoAMyContainer cannot store bool columns (std::vector<bool> has no element references)");
+
+public:
+    static constexpr size_t kColumnCount = sizeof...(Members);
+
+    /// Pointer to the data member stored in column I.
+    template<size_t I>
+    static constexpr auto member = std::get<I>(std::tuple<decltype(Members)...>(Members...));
+
+    /// Value type of column I.
+    template<size_t I>
+    using column_type = typename soa_detail::MemberTraits<std::remove_cv_t<decltype(member<I>)>>::value_type;
+
+private:
+    std::tuple<std::vector<typename soa_detail::MemberTraits<decltype(Members)>::value_type>...> columns;
+
+    template<size_t... I>
+    void pushRow(const T& row, std::index_sequence<I...>) {
+        (std::get<I>(columns).push_back(row.*member<I>), ...);
+    }
+
+    template<size_t... I>
+    bool rowEquals(size_t r, const T& row, std::index_sequence<I...>) const {
+        return ((std::get<I>(columns)[r] == row.*member<I>) && ...);
+    }
+
+    template<size_t... I>
+    void moveRow(size_t from, size_t to, std::index_sequence<I...>) {
+        ((std::get<I>(columns)[to] = std::move(std::get<I>(columns)[from])), ...);
+    }
+
+    template<size_t... I>
+    void truncate(size_t n, std::index_sequence<I...>) {
+        (std::get<I>(columns).resize(n), ...);
+    }
+
+public:
+    /**
+     * @brief Lightweight reference to one row; reads its columns on demand.
+     */
+    class RowRef {
+    private:
+        const SoAMyContainer* owner;
+        size_t row;
+
+        template<size_t... I>
+        T build(std::index_sequence<I...>) const {
+            T value{};
+            ((value.*member<I> = get<I>()), ...);
+            return value;
+        }
+    public:
+        RowRef(const SoAMyContainer* c, size_t r) : owner(c), row(r) {}
+
+        /**
+         * @brief Returns the value of column I for this row.
+         */
+        template<size_t I>
+        const column_type<I>& get() const { return std::get<I>(owner->columns)[row]; }
+
+        /**
+         * @brief Copies the stored columns into a T (other members are value-initialized).
+         */
+        T materialize() const { return build(std::make_index_sequence<kColumnCount>()); }
+
+        /**
+         * @brief Position of the row in insertion order.
+         */
+        size_t index() const { return row; }
+    };
+
+private:
+    /**
+     * @brief Iterator yielding RowRef proxies, through a permutation or directly.
+     */
+    class RowIterator {
+    private:
+        const SoAMyContainer* owner;
+        const size_t* permutation; // nullptr: rows in insertion order
+        size_t pos;
+        bool reverse;              // Read rows from the end
+    public:
+        RowIterator(const SoAMyContainer* c, const size_t* perm, size_t p, bool rev)
+            : owner(c), permutation(perm), pos(p), reverse(rev) {}
+
+        RowRef operator*() const {
+            size_t i = reverse ? owner->size() - 1 - pos : pos;
+            return RowRef(owner, permutation ? permutation[i] : i);
+        }
+
+        RowIterator& operator++() { ++pos; return *this; } // Prefix increment
+
+        RowIterator operator++(int) { RowIterator temp = *this; ++(*this); return temp; } // Postfix increment
+
+        bool operator!=(const RowIterator& other) const { return pos != other.pos || owner != other.owner; }
+
+        bool operator==(const RowIterator& other) const { return !(*this != other); }
+    };
+
+    /**
+     * @brief View over rows in insertion order, forward or backward.
+     */
+    template<bool Reverse>
+    class StorageOrder {
+    private:
+        const SoAMyContainer& owner;
+    public:
+        StorageOrder(const SoAMyContainer& c) : owner(c) {}
+        RowIterator begin() const { return RowIterator(&owner, nullptr, 0, Reverse); }
+        RowIterator end() const { return RowIterator(&owner, nullptr, owner.size(), Reverse); }
+    };
+
+    /**
+     * @brief View sorted by column I; sorts only that column plus a permutation.
+     */
+    template<size_t I, bool Descending>
+    class ColumnOrder {
+    private:
+        const SoAMyContainer& owner;
+        std::vector<size_t> permutation;
+    public:
+        ColumnOrder(const SoAMyContainer& c) : owner(c) {
+            ordering::sortPermutation(std::get<I>(c.columns), permutation, std::less<>(), ordering::Identity());
+        }
+        RowIterator begin() const { return RowIterator(&owner, permutation.data(), 0, Descending); }
+        RowIterator end() const { return RowIterator(&owner, permutation.data(), owner.size(), Descending); }
+    };
+
+public:
+    /**
+     * @brief Appends an element, splitting it into its columns.
+     * @param element The element to add.
+     */
+    void addElement(const T& element) { pushRow(element, std::make_index_sequence<kColumnCount>()); }
+
+    /**
+     * @brief Removes all rows whose stored columns equal those of element.
+     * @param element The element to remove.
+     * @throws std::runtime_error If the element is not found.
+     */
+    void remove(const T& element) {
+        const size_t n = size();
+        size_t kept = 0;
+        for (size_t r = 0; r < n; ++r) {
+            if (rowEquals(r, element, std::make_index_sequence<kColumnCount>())) continue;
+            if (kept != r) moveRow(r, kept, std::make_index_sequence<kColumnCount>());
+            ++kept;
+        }
+        if (kept == n)
+            throw std::runtime_error("Element not found in container");
+        truncate(kept, std::make_index_sequence<kColumnCount>());
+    }
+
+    /**
+     * @brief Returns the number of elements in the container.
+     */
+    size_t size() const { return std::get<0>(columns).size(); }
+
+    /**
+     * @brief Returns the contiguous column holding member I of every element.
+     */
+    template<size_t I>
+    const std::vector<column_type<I>>& column() const { return std::get<I>(columns); }
+
+    /**
+     * @brief Returns a proxy for the row at a position in insertion order.
+     * @throws std::out_of_range If the index is out of range.
+     */
+    RowRef at(size_t i) const {
+        if (i >= size()) throw std::out_of_range("Index out of range");
+        return RowRef(this, i);
+    }
+
+    /// Rows in insertion order.
+    using Order = StorageOrder<false>;
+    /// Rows in reverse insertion order.
+    using ReverseOrder = StorageOrder<true>;
+    /// Rows by ascending column I (stable).
+    template<size_t I>
+    using AscendingOrder = ColumnOrder<I, false>;
+    /// Rows by descending column I (the reverse of AscendingOrder<I>).
+    template<size_t I>
+    using DescendingOrder = ColumnOrder<I, true>;
+};
+
+} // namespace my_container_project
@@ -0,0 +1,219 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace my_container_project {
+
+/**
+ * @brief Fixed-size container usable in constexpr contexts.
+ *
+ * Elements are given at construction and stored in a std::array. Every view
+ * is a literal type whose constructor computes its order into its own
+ * std::array, so a view declared constexpr is fully computed by the compiler
+ * and iterating it at run time only walks an array.
+ * @tparam T Literal element type with a constexpr operator< (default: int)
+ * @tparam N Number of elements
+ */
+namespace detail {
+
+/**
+ * @brief True if From converts to To in list-initialization, i.e. without narrowing.
+ */
+template<typename To, typename From, typename = void>
+struct convertsWithoutNarrowing : std::false_type {};
+
+template<typename To, typename From>
+struct convertsWithoutNarrowing<To, From, std::void_t<decltype(To{std::declval<From>()})>> : std::true_type {};
+
+} // namespace detail
+
+template<typename T = int, size_t N = 0>
+class StaticMyContainer {
+private:
+    std::array<T, N> elements{};
+
+    /**
+     * @brief Stable constexpr insertion sort (std::sort is not constexpr in C++17).
+     */
+    static constexpr void insertionSort(std::array<T, N>& a) {
+        for (size_t i = 1; i < N; ++i) {
+            T value = a[i];
+            size_t j = i;
+            while (j > 0 && value < a[j - 1]) {
+                a[j] = a[j - 1];
+                --j;
+            }
+            a[j] = value;
+        }
+    }
+
+    static constexpr std::array<T, N> sortedCopy(const StaticMyContainer& c) {
+        std::array<T, N> sorted = c.elements;
+        insertionSort(sorted);
+        return sorted;
+    }
+
+    /**
+     * @brief Iterator over a view's array, with the same operations as
+     *        MyContainer's view iterators. Access outside the view throws
+     *        std::out_of_range, like their at() (a compile error in constant evaluation).
+     */
+    class Iterator {
+    private:
+        const T* base;
+        size_t idx;
+
+        static constexpr const T& checked(const T* b, size_t i) {
+            if (i >= N) throw std::out_of_range("Index out of range");
+            return b[i];
+        }
+    public:
+        constexpr Iterator(const T* b, size_t i) : base(b), idx(i) {}
+
+        constexpr const T& operator*() const { return checked(base, idx); }
+
+        constexpr Iterator& operator++() { ++idx; return *this; } // Prefix increment
+
+        constexpr Iterator operator++(int) { Iterator temp = *this; ++idx; return temp; } // Postfix increment
+
+        constexpr Iterator& operator--() { --idx; return *this; } // Prefix decrement
+
+        constexpr Iterator operator--(int) { Iterator temp = *this; --idx; return temp; } // Postfix decrement
+
+        constexpr Iterator operator+(size_t n) const { return Iterator(base, idx + n); } // Advance by n
+
+        constexpr Iterator operator-(size_t n) const { return Iterator(base, idx - n); } // Retreat by n
+
+        constexpr const T& operator[](size_t n) const { return checked(base, idx + n); } // Access by index
+
+        constexpr bool operator!=(const Iterator& other) const { return idx != other.idx || base != other.base; }
+
+        constexpr bool operator==(const Iterator& other) const { return !(*this != other); }
+    };
+
+    /**
+     * @brief View owning its order as an array.
+     */
+    class ArrayView {
+    protected:
+        std::array<T, N> ordered{};
+        constexpr ArrayView() = default;
+    public:
+        constexpr Iterator begin() const { return Iterator(ordered.data(), 0); }
+        constexpr Iterator end() const { return Iterator(ordered.data(), N); }
+
+        /**
+         * @brief Returns the computed order.
+         */
+        constexpr const std::array<T, N>& values() const { return ordered; }
+    };
+
+public:
+    constexpr StaticMyContainer() = default;
+
+    /**
+     * @brief Constructs the container from exactly N elements.
+     * Only arguments that convert to T without narrowing are accepted, so
+     * StaticMyContainer<int, 2>{1, 2.5} does not compile.
+     * @param values The elements, in insertion order.
+     */
+    template<typename... Values,
+             typename = std::enable_if_t<(detail::convertsWithoutNarrowing<T, const Values&>::value && ...)>>
+    constexpr explicit StaticMyContainer(const T& first, const Values&... rest) : elements{{first, rest...}} {
+        static_assert(1 + sizeof...(Values) == N, "StaticMyContainer needs exactly N elements");
+    }
+
+    /**
+     * @brief Returns the number of elements in the container.
+     */
+    constexpr size_t size() const { return N; }
+
+    /**
+     * @brief Returns the element at a position in insertion order.
+     * @throws std::out_of_range If the index is out of range (a compile error in constant evaluation).
+     */
+    constexpr const T& at(size_t i) const {
+        if (i >= N) throw std::out_of_range("Index out of range");
+        return elements[i];
+    }
+
+    /**
+     * @brief Original order iterator (in insertion order).
+     */
+    class Order : public ArrayView {
+    public:
+        constexpr Order(const StaticMyContainer& c) { this->ordered = c.elements; }
+    };
+
+    /**
+     * @brief Reverse order iterator (original insertion order, reversed).
+     */
+    class ReverseOrder : public ArrayView {
+    public:
+        constexpr ReverseOrder(const StaticMyContainer& c) {
+            for (size_t i = 0; i < N; ++i) this->ordered[i] = c.elements[N - 1 - i];
+        }
+    };
+
+    /**
+     * @brief Ascending order iterator (from smallest to largest).
+     */
+    class AscendingOrder : public ArrayView {
+    public:
+        constexpr AscendingOrder(const StaticMyContainer& c) { this->ordered = sortedCopy(c); }
+    };
+
+    /**
+     * @brief Descending order iterator (from largest to smallest).
+     */
+    class DescendingOrder : public ArrayView {
+    public:
+        constexpr DescendingOrder(const StaticMyContainer& c) {
+            std::array<T, N> sorted = sortedCopy(c);
+            for (size_t i = 0; i < N; ++i) this->ordered[i] = sorted[N - 1 - i];
+        }
+    };
+
+    /**
+     * @brief Side-cross order: smallest, largest, second smallest, ...
+     */
+    class SideCrossOrder : public ArrayView {
+    public:
+        constexpr SideCrossOrder(const StaticMyContainer& c) {
+            std::array<T, N> sorted = sortedCopy(c);
+            size_t left = 0, right = N, out = 0;
+            while (left < right) {
+                this->ordered[out++] = sorted[left++];
+                if (left < right) this->ordered[out++] = sorted[--right];
+            }
+        }
+    };
+
+    /**
+     * @brief Middle-out order: middle (rounded down), then alternately left and right.
+     */
+    class MiddleOutOrder : public ArrayView {
+    public:
+        constexpr MiddleOutOrder(const StaticMyContainer& c) {
+            if (N == 0) return;
+            size_t mid = (N % 2 == 0) ? (N / 2 - 1) : (N / 2);
+            size_t out = 0;
+            this->ordered[out++] = c.elements[mid];
+            for (size_t step = 1; step <= mid || mid + step < N; ++step) {
+                if (step <= mid) this->ordered[out++] = c.elements[mid - step];
+                if (mid + step < N) this->ordered[out++] = c.elements[mid + step];
+            }
+        }
+    };
+};
+
+/**
+ * @brief Deduces StaticMyContainer<T, N> from N constructor arguments.
+ */
+template<typename T, typename... Values>
+StaticMyContainer(T, Values...) -> StaticMyContainer<T, 1 + sizeof...(Values)>;
+
+} // namespace my_container_project
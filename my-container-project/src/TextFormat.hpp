@@ -0,0 +1,283 @@
+#pragma once
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ios>
+#include <istream>
+#include <iterator>
+#include <locale>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <unistd.h>
+
+namespace my_container_project {
+namespace text_format {
+
+/// Size of the local formatting buffer; output is flushed in chunks of this size.
+constexpr size_t kBufferSize = 1 << 16;
+
+/// Room for sign, decimal point, exponent and separator around the formatted digits.
+constexpr size_t kMaxScalarChars = 64;
+
+/// Largest ostream precision handled by the fast path.
+constexpr std::streamsize kMaxPrecision = 1024;
+
+template<typename T>
+constexpr bool isCharacter = std::is_same<T, char>::value || std::is_same<T, signed char>::value ||
+                             std::is_same<T, unsigned char>::value;
+
+/**
+ * @brief True if T is formatted by the buffered fast path instead of std::ostream.
+ * Covers the types whose default ostream output can be reproduced byte for byte.
+ */
+template<typename T>
+constexpr bool hasFastFormat =
+    isCharacter<T> || std::is_same<T, bool>::value || std::is_floating_point<T>::value ||
+    std::is_same<T, std::string>::value ||
+    (std::is_integral<T>::value && !std::is_same<T, wchar_t>::value &&
+     !std::is_same<T, char16_t>::value && !std::is_same<T, char32_t>::value);
+
+/**
+ * @brief True if os would format values exactly like the fast path does:
+ * default flags, no field width, a bounded precision and the classic locale.
+ */
+inline bool usesDefaultFormatting(const std::ostream& os) {
+    return os.flags() == (std::ios_base::skipws | std::ios_base::dec) && os.width() == 0 &&
+           os.precision() <= kMaxPrecision && os.getloc() == std::locale::classic();
+}
+
+/**
+ * @brief Formats each element followed by a space into a local buffer,
+ *        handing full chunks to sink(const char*, size_t).
+ * Output is identical to `os << el << " "` on a default-formatted stream.
+ * @param precision Significant digits for floating point values (ostream precision).
+ */
+template<typename It, typename Sink>
+void formatRange(It first, It last, Sink&& sink, std::streamsize precision = 6) {
+    using T = typename std::iterator_traits<It>::value_type;
+    char buffer[kBufferSize];
+    size_t used = 0;
+    auto flush = [&]() {
+        if (used) sink(buffer, used);
+        used = 0;
+    };
+
+    if constexpr (std::is_same<T, std::string>::value) {
+        for (; first != last; ++first) {
+            const std::string& s = *first;
+            if (used + s.size() + 1 > kBufferSize) {
+                flush();
+                if (s.size() + 1 > kBufferSize) {
+                    sink(s.data(), s.size());
+                    sink(" ", 1);
+                    continue;
+                }
+            }
+            std::memcpy(buffer + used, s.data(), s.size());
+            used += s.size();
+            buffer[used++] = ' ';
+        }
+    } else if constexpr (hasFastFormat<T>) {
+        // Precision 0 behaves like 1 for %g, as it does for ostream.
+        const int digits = precision > 0 ? static_cast<int>(std::min(precision, kMaxPrecision)) : 1;
+        const size_t reserve = kMaxScalarChars + static_cast<size_t>(digits);
+        for (; first != last; ++first) {
+            if (used + reserve > kBufferSize) flush();
+            const T& value = *first;
+            char* out = buffer + used;
+            if constexpr (isCharacter<T>) {
+                *out++ = static_cast<char>(value);
+            } else if constexpr (std::is_same<T, bool>::value) {
+                *out++ = value ? '1' : '0';
+            } else if constexpr (std::is_floating_point<T>::value) {
+                out = std::to_chars(out, buffer + kBufferSize, value, std::chars_format::general, digits).ptr;
+            } else {
+                out = std::to_chars(out, buffer + kBufferSize, value).ptr;
+            }
+            *out++ = ' ';
+            used = static_cast<size_t>(out - buffer);
+        }
+    } else {
+        std::ostringstream oss;
+        for (; first != last; ++first) {
+            oss.str(std::string());
+            oss << *first << ' ';
+            const std::string& s = oss.str();
+            if (used + s.size() > kBufferSize) {
+                flush();
+                if (s.size() > kBufferSize) {
+                    sink(s.data(), s.size());
+                    continue;
+                }
+            }
+            std::memcpy(buffer + used, s.data(), s.size());
+            used += s.size();
+        }
+    }
+    flush();
+}
+
+/**
+ * @brief Sink writing chunks to a stdio stream.
+ * @throws std::runtime_error On a short write.
+ */
+inline auto fileSink(std::FILE* out) {
+    return [out](const char* data, size_t n) {
+        if (std::fwrite(data, 1, n, out) != n)
+            throw std::runtime_error("Failed writing container to FILE stream");
+    };
+}
+
+/**
+ * @brief Sink writing chunks to a file descriptor, retrying partial writes.
+ * @throws std::runtime_error If write() fails.
+ */
+inline auto fdSink(int fd) {
+    return [fd](const char* data, size_t n) {
+        while (n > 0) {
+            ssize_t written = ::write(fd, data, n);
+            if (written < 0) {
+                if (errno == EINTR) continue;
+                throw std::runtime_error(std::string("Failed writing container to fd: ") + std::strerror(errno));
+            }
+            data += written;
+            n -= static_cast<size_t>(written);
+        }
+    };
+}
+
+/// Size of each block read by the text parser.
+constexpr size_t kReadBlockSize = 1 << 20;
+
+/**
+ * @brief True if T can be read back by parseStream().
+ */
+template<typename T>
+constexpr bool hasFastParse = hasFastFormat<T>;
+
+/**
+ * @brief True for the delimiters written or accepted between values (isspace in the C locale).
+ */
+inline bool isDelimiter(char c) {
+    return c == ' ' || static_cast<unsigned char>(c - '\t') < 5;
+}
+
+/**
+ * @brief Returns the first delimiter in [p, end), or end.
+ * Scans 16 bytes at a time with SSE2 when available.
+ */
+inline const char* findDelimiter(const char* p, const char* end) {
+#if defined(__SSE2__)
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i tab = _mm_set1_epi8('\t');
+    const __m128i four = _mm_set1_epi8(4);
+    while (end - p >= 16) {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        __m128i shifted = _mm_sub_epi8(bytes, tab); // '\t'..'\r' map to 0..4
+        __m128i isControl = _mm_cmpeq_epi8(_mm_min_epu8(shifted, four), shifted);
+        __m128i isSpace = _mm_cmpeq_epi8(bytes, space);
+        int mask = _mm_movemask_epi8(_mm_or_si128(isControl, isSpace));
+        if (mask) return p + __builtin_ctz(static_cast<unsigned>(mask));
+        p += 16;
+    }
+#endif
+    while (p != end && !isDelimiter(*p)) ++p;
+    return p;
+}
+
+/**
+ * @brief Parses one whitespace-free token into value.
+ * @return false if the token is not a complete valid value.
+ */
+template<typename T>
+bool parseToken(const char* first, const char* last, T& value) {
+    if constexpr (std::is_same<T, std::string>::value) {
+        value.assign(first, last);
+        return true;
+    } else if constexpr (std::is_same<T, bool>::value) {
+        if (last - first != 1 || (*first != '0' && *first != '1')) return false;
+        value = *first == '1';
+        return true;
+    } else {
+        if (first != last && *first == '+') ++first; // Accepted by operator>>, not by from_chars
+        std::from_chars_result r;
+        if constexpr (std::is_floating_point<T>::value)
+            r = std::from_chars(first, last, value, std::chars_format::general);
+        else
+            r = std::from_chars(first, last, value);
+        return r.ec == std::errc() && r.ptr == last;
+    }
+}
+
+/**
+ * @brief Appends every whitespace-delimited value read from in to out.
+ *
+ * Input is read in kReadBlockSize blocks and parsed with std::from_chars.
+ * Character types take every non-whitespace byte as one value, mirroring
+ * operator>>. If totalBytes is known, storage is reserved once from the value
+ * density of the first block. On a parse error out is left unchanged.
+ * @param totalBytes Expected input size in bytes, or 0 if unknown.
+ * @return Number of values appended.
+ * @throws std::runtime_error On a malformed value or a read error.
+ */
+template<typename T, typename Alloc>
+size_t parseStream(std::istream& in, std::vector<T, Alloc>& out, uint64_t totalBytes = 0) {
+    static_assert(hasFastParse<T>, "loadText supports arithmetic types and std::string");
+    const size_t before = out.size();
+    std::vector<char> buffer(kReadBlockSize);
+    size_t carried = 0; // Bytes of an unfinished token kept at the front of buffer
+    uint64_t consumed = 0;
+    bool reserved = totalBytes == 0;
+    T value{};
+    try {
+        for (;;) {
+            if (carried == buffer.size()) buffer.resize(buffer.size() * 2); // Token longer than a block
+            in.read(buffer.data() + carried, static_cast<std::streamsize>(buffer.size() - carried));
+            const size_t got = static_cast<size_t>(in.gcount());
+            if (in.bad()) throw std::runtime_error("Read error while loading text");
+            const bool last = got == 0 || in.eof();
+            const char* p = buffer.data();
+            const char* end = p + carried + got;
+            while (p != end) {
+                if (isDelimiter(*p)) { ++p; continue; }
+                if constexpr (isCharacter<T>) {
+                    out.push_back(static_cast<T>(*p++));
+                    continue;
+                }
+                const char* tokenEnd = findDelimiter(p, end);
+                if (tokenEnd == end && !last) break; // Token may continue in the next block
+                if (!parseToken(p, tokenEnd, value))
+                    throw std::runtime_error("Invalid value in text input: '" + std::string(p, tokenEnd) + "'");
+                out.push_back(std::move(value));
+                p = tokenEnd;
+            }
+            carried = static_cast<size_t>(end - p);
+            consumed += static_cast<uint64_t>(p - buffer.data());
+            if (!reserved && consumed > 0 && consumed < totalBytes) {
+                double perByte = static_cast<double>(out.size() - before) / static_cast<double>(consumed);
+                out.reserve(out.size() + static_cast<size_t>(perByte * static_cast<double>(totalBytes - consumed) * 1.05) + 16);
+                reserved = true;
+            }
+            if (last) break;
+            std::memmove(buffer.data(), p, carried);
+        }
+    } catch (...) {
+        out.erase(out.begin() + static_cast<std::ptrdiff_t>(before), out.end());
+        throw;
+    }
+    return out.size() - before;
+}
+
+} // namespace text_format
+} // namespace my_container_project
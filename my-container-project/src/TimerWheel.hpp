@@ -0,0 +1,179 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace my_container_project {
+
+/**
+ * @brief Hierarchical timer wheel over integer deadlines (Varghese and Lauck 1987).
+ *
+ * Eleven levels of 64 slots cover the whole 64-bit time range: level L holds
+ * deadlines that agree with the current time above bit 6(L+1), bucketed by
+ * bits [6L, 6L+6). Scheduling is O(1). advance() jumps straight to the next
+ * occupied slot using per-level occupancy masks, so idle time costs nothing;
+ * reaching a slot on a higher level cascades its deadlines down, so each
+ * deadline is moved at most once per level. cancel() removes a
+ * deadline whose owner went away, so it never fires. Time is an abstract tick count
+ * supplied by the caller, so behaviour is deterministic.
+ */
+class TimerWheel {
+private:
+    static constexpr unsigned kSlotBits = 6;
+    static constexpr unsigned kSlots = 1u << kSlotBits;
+    static constexpr unsigned kLevels = (64 + kSlotBits - 1) / kSlotBits;
+
+    std::array<std::array<std::vector<uint64_t>, kSlots>, kLevels> slots;
+    std::array<uint64_t, kLevels> occupied{}; // Bit j set: slots[L][j] is non-empty
+    uint64_t current;
+    size_t due = 0;     // Deadlines at or before current, reported by the next advance()
+    size_t pending = 0; // Deadlines not yet reported
+
+    static unsigned highestBit(uint64_t x) { // x != 0
+#if defined(__GNUC__)
+        return 63u - static_cast<unsigned>(__builtin_clzll(x));
+#else
+        unsigned n = 0;
+        while (x >>= 1) ++n;
+        return n;
+#endif
+    }
+
+    static unsigned lowestBit(uint64_t x) { // x != 0
+#if defined(__GNUC__)
+        return static_cast<unsigned>(__builtin_ctzll(x));
+#else
+        unsigned n = 0;
+        while (!(x & 1)) { x >>= 1; ++n; }
+        return n;
+#endif
+    }
+
+    static unsigned slotOf(uint64_t time, unsigned level) {
+        return static_cast<unsigned>((time >> (kSlotBits * level)) & (kSlots - 1));
+    }
+
+    /**
+     * @brief Start of the current rotation of a level: time with its low 6(L+1) bits cleared.
+     */
+    static uint64_t rotationStart(uint64_t time, unsigned level) {
+        const unsigned bits = kSlotBits * (level + 1);
+        return bits >= 64 ? 0 : time & ~((uint64_t(1) << bits) - 1);
+    }
+
+    void place(uint64_t deadline) {
+        if (deadline <= current) {
+            ++due;
+            return;
+        }
+        const unsigned level = highestBit(deadline ^ current) / kSlotBits;
+        const unsigned slot = slotOf(deadline, level);
+        slots[level][slot].push_back(deadline);
+        occupied[level] |= uint64_t(1) << slot;
+    }
+
+public:
+    /**
+     * @brief Constructs an empty wheel.
+     * @param start Initial time.
+     */
+    explicit TimerWheel(uint64_t start = 0) : current(start) {}
+
+    /**
+     * @brief Schedules a deadline; one at or before the current time fires on the next advance().
+     */
+    void schedule(uint64_t deadline) {
+        place(deadline);
+        ++pending;
+    }
+
+    /**
+     * @brief Moves the clock to now.
+     * @return Number of scheduled deadlines that are now at or before the clock.
+     * @throws std::invalid_argument If now is before the current time.
+     */
+    size_t advance(uint64_t now) {
+        if (now < current) throw std::invalid_argument("Time cannot go backwards");
+        size_t fired = due;
+        due = 0;
+        for (;;) {
+            // The lowest level with an occupied slot after its current one holds the next event
+            unsigned level = 0, slot = 0;
+            for (; level < kLevels; ++level) {
+                const unsigned s = slotOf(current, level);
+                const uint64_t ahead = s + 1 == kSlots ? 0 : occupied[level] & (~uint64_t(0) << (s + 1));
+                if (ahead) {
+                    slot = lowestBit(ahead);
+                    break;
+                }
+            }
+            if (level == kLevels) break;
+            const uint64_t start = rotationStart(current, level) | (uint64_t(slot) << (kSlotBits * level));
+            if (start > now) break;
+            current = start;
+            std::vector<uint64_t> bucket;
+            bucket.swap(slots[level][slot]);
+            occupied[level] &= ~(uint64_t(1) << slot);
+            if (level == 0) {
+                fired += bucket.size();
+            } else {
+                for (uint64_t deadline : bucket) place(deadline); // Cascade to lower levels
+                fired += due;
+                due = 0;
+            }
+        }
+        current = now;
+        pending -= fired;
+        return fired;
+    }
+
+    /**
+     * @brief Cancels one pending occurrence of a deadline that has not been
+     *        reported by advance() yet. O(levels + size of its slot).
+     * @return False if no such deadline is pending.
+     */
+    bool cancel(uint64_t deadline) {
+        if (deadline <= current) {
+            if (due == 0) return false;
+            --due;
+            --pending;
+            return true;
+        }
+        // The clock never leaves a rotation before reaching its slots, so a
+        // deadline sits at or above the level it would be placed on now
+        for (unsigned level = highestBit(deadline ^ current) / kSlotBits; level < kLevels; ++level) {
+            const unsigned slot = slotOf(deadline, level);
+            std::vector<uint64_t>& bucket = slots[level][slot];
+            for (size_t i = bucket.size(); i-- > 0;) {
+                if (bucket[i] != deadline) continue;
+                bucket[i] = bucket.back();
+                bucket.pop_back();
+                if (bucket.empty()) occupied[level] &= ~(uint64_t(1) << slot);
+                --pending;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Drops every scheduled deadline; the clock is kept.
+     */
+    void clear() {
+        for (auto& level : slots)
+            for (auto& bucket : level) bucket.clear();
+        occupied.fill(0);
+        due = pending = 0;
+    }
+
+    uint64_t now() const { return current; }
+
+    /**
+     * @brief Number of scheduled deadlines not yet reported by advance().
+     */
+    size_t pendingCount() const { return pending; }
+};
+
+} // namespace my_container_project
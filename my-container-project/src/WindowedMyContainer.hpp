@@ -0,0 +1,325 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace my_container_project {
+
+/**
+ * @brief Sliding window over the last `capacity` elements added.
+ *
+ * Once full, addElement() evicts the oldest element. Elements live in a node
+ * pool and the window order in a ring of node ids; both are allocated once at
+ * construction and never reallocate. The nodes also form an order-statistic
+ * treap keyed by (value, insertion sequence), so every update is O(log N) and
+ * the k-th smallest, min, max and median are O(log N) without sorting.
+ * Sorted views read the treap in order, which is O(N) with no comparisons.
+ * @tparam T Element type with operator< and operator== (default: int)
+ */
+template<typename T = int>
+class WindowedMyContainer {
+private:
+    static constexpr uint32_t kNil = std::numeric_limits<uint32_t>::max();
+
+    struct Node {
+        T value;
+        uint64_t seq;       // Insertion sequence: breaks ties, so keys are unique
+        uint32_t priority;  // Max-heap order of the treap
+        uint32_t left = kNil, right = kNil;
+        uint32_t count = 1; // Subtree size
+    };
+
+    std::vector<Node> pool;         // Node storage, at most `capacity` nodes
+    std::vector<uint32_t> freeList; // Pool slots released by remove()
+    std::vector<uint32_t> ring;     // Node ids in window order, starting at head
+    size_t head = 0;
+    size_t count = 0;
+    uint32_t root = kNil;
+    uint64_t nextSeq = 0;
+    uint64_t rngState = 0x9E3779B97F4A7C15ull;
+
+    uint32_t randomPriority() { // splitmix64
+        uint64_t z = (rngState += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return static_cast<uint32_t>((z ^ (z >> 31)) >> 32);
+    }
+
+    uint32_t sizeOf(uint32_t t) const { return t == kNil ? 0 : pool[t].count; }
+
+    void update(uint32_t t) { pool[t].count = 1 + sizeOf(pool[t].left) + sizeOf(pool[t].right); }
+
+    bool keyLess(uint32_t a, uint32_t b) const {
+        const Node& x = pool[a];
+        const Node& y = pool[b];
+        if (x.value < y.value) return true;
+        if (y.value < x.value) return false;
+        return x.seq < y.seq;
+    }
+
+    /**
+     * @brief Splits subtree t into nodes ordered before node key (l) and the rest (r).
+     */
+    void split(uint32_t t, uint32_t key, uint32_t& l, uint32_t& r) {
+        if (t == kNil) {
+            l = r = kNil;
+        } else if (keyLess(t, key)) {
+            split(pool[t].right, key, pool[t].right, r);
+            l = t;
+            update(t);
+        } else {
+            split(pool[t].left, key, l, pool[t].left);
+            r = t;
+            update(t);
+        }
+    }
+
+    /**
+     * @brief Joins two subtrees where every key of a precedes every key of b.
+     */
+    uint32_t join(uint32_t a, uint32_t b) {
+        if (a == kNil) return b;
+        if (b == kNil) return a;
+        if (pool[a].priority > pool[b].priority) {
+            pool[a].right = join(pool[a].right, b);
+            update(a);
+            return a;
+        }
+        pool[b].left = join(a, pool[b].left);
+        update(b);
+        return b;
+    }
+
+    uint32_t insertNode(uint32_t t, uint32_t n) {
+        if (t == kNil) return n;
+        if (pool[n].priority > pool[t].priority) {
+            split(t, n, pool[n].left, pool[n].right);
+            update(n);
+            return n;
+        }
+        if (keyLess(n, t)) pool[t].left = insertNode(pool[t].left, n);
+        else pool[t].right = insertNode(pool[t].right, n);
+        update(t);
+        return t;
+    }
+
+    uint32_t eraseNode(uint32_t t, uint32_t n) {
+        if (t == n) return join(pool[t].left, pool[t].right);
+        if (keyLess(n, t)) pool[t].left = eraseNode(pool[t].left, n);
+        else pool[t].right = eraseNode(pool[t].right, n);
+        update(t);
+        return t;
+    }
+
+    uint32_t nthNode(size_t k) const {
+        uint32_t t = root;
+        for (;;) {
+            const size_t leftSize = sizeOf(pool[t].left);
+            if (k < leftSize) {
+                t = pool[t].left;
+            } else if (k == leftSize) {
+                return t;
+            } else {
+                k -= leftSize + 1;
+                t = pool[t].right;
+            }
+        }
+    }
+
+    /**
+     * @brief Appends pointers to the values of subtree t, in ascending order.
+     */
+    void collect(uint32_t t, std::vector<const T*>& out) const {
+        while (t != kNil) {
+            collect(pool[t].left, out);
+            out.push_back(&pool[t].value);
+            t = pool[t].right;
+        }
+    }
+
+    uint32_t slot(size_t i) const { return ring[(head + i) % ring.size()]; }
+
+    void requireNonEmpty() const {
+        if (count == 0) throw std::runtime_error("Container is empty");
+    }
+
+    /**
+     * @brief Iterator over a sequence of value pointers or ring positions, forward or backward.
+     */
+    class WindowIterator {
+    private:
+        const WindowedMyContainer* owner;
+        const T* const* values; // nullptr: read the ring
+        size_t pos;
+        bool reverse;           // Counts down and reads position pos - 1
+    public:
+        WindowIterator(const WindowedMyContainer* c, const T* const* v, size_t p, bool rev)
+            : owner(c), values(v), pos(p), reverse(rev) {}
+
+        const T& operator*() const {
+            const size_t i = reverse ? pos - 1 : pos;
+            return values ? *values[i] : owner->pool[owner->slot(i)].value;
+        }
+
+        WindowIterator& operator++() { if (reverse) --pos; else ++pos; return *this; } // Prefix increment
+
+        WindowIterator operator++(int) { WindowIterator temp = *this; ++(*this); return temp; } // Postfix increment
+
+        bool operator!=(const WindowIterator& other) const { return pos != other.pos || owner != other.owner; }
+
+        bool operator==(const WindowIterator& other) const { return !(*this != other); }
+    };
+
+    /**
+     * @brief View over the window in insertion order; reads the ring, no copy.
+     */
+    template<bool Reverse>
+    class WindowOrder {
+    private:
+        const WindowedMyContainer& owner;
+    public:
+        WindowOrder(const WindowedMyContainer& c) : owner(c) {}
+        WindowIterator begin() const { return WindowIterator(&owner, nullptr, Reverse ? owner.count : 0, Reverse); }
+        WindowIterator end() const { return WindowIterator(&owner, nullptr, Reverse ? 0 : owner.count, Reverse); }
+    };
+
+    /**
+     * @brief Sorted view: pointers to the values, from an in-order walk of the treap.
+     */
+    template<bool Descending>
+    class TreeOrder {
+    private:
+        const WindowedMyContainer& owner;
+        std::vector<const T*> values;
+    public:
+        TreeOrder(const WindowedMyContainer& c) : owner(c) {
+            values.reserve(c.count);
+            c.collect(c.root, values);
+        }
+        WindowIterator begin() const { return WindowIterator(&owner, values.data(), Descending ? values.size() : 0, Descending); }
+        WindowIterator end() const { return WindowIterator(&owner, values.data(), Descending ? 0 : values.size(), Descending); }
+    };
+
+public:
+    /**
+     * @brief Constructs an empty window and allocates all of its storage.
+     * @param capacity Number of most recent elements kept.
+     * @throws std::invalid_argument If capacity is 0 or does not fit 32-bit node ids.
+     */
+    explicit WindowedMyContainer(size_t capacity) {
+        if (capacity == 0 || capacity >= kNil) throw std::invalid_argument("Window capacity must be in [1, 2^32 - 1)");
+        pool.reserve(capacity);
+        freeList.reserve(capacity);
+        ring.assign(capacity, kNil);
+    }
+
+    /**
+     * @brief Adds an element, evicting the oldest one if the window is full. O(log N).
+     * @param element The element to add.
+     */
+    void addElement(const T& element) {
+        uint32_t id;
+        if (count == ring.size()) { // Reuse the evicted node
+            id = ring[head];
+            root = eraseNode(root, id);
+            head = (head + 1) % ring.size();
+            --count;
+            pool[id].value = element;
+        } else if (!freeList.empty()) {
+            id = freeList.back();
+            freeList.pop_back();
+            pool[id].value = element;
+        } else {
+            id = static_cast<uint32_t>(pool.size());
+            pool.push_back(Node{element, 0, 0});
+        }
+        Node& node = pool[id];
+        node.seq = nextSeq++;
+        node.priority = randomPriority();
+        node.left = node.right = kNil;
+        node.count = 1;
+        root = insertNode(root, id);
+        ring[(head + count) % ring.size()] = id;
+        ++count;
+    }
+
+    /**
+     * @brief Removes all occurrences of an element from the window. O(N).
+     * @param element The element to remove.
+     * @throws std::runtime_error If the element is not found.
+     */
+    void remove(const T& element) {
+        size_t kept = 0;
+        for (size_t i = 0; i < count; ++i) {
+            const uint32_t id = slot(i);
+            if (pool[id].value == element) {
+                root = eraseNode(root, id);
+                freeList.push_back(id);
+            } else {
+                ring[(head + kept++) % ring.size()] = id;
+            }
+        }
+        if (kept == count)
+            throw std::runtime_error("Element not found in container");
+        count = kept;
+    }
+
+    /**
+     * @brief Empties the window; the storage is kept.
+     */
+    void clear() {
+        pool.clear();
+        freeList.clear();
+        head = count = 0;
+        root = kNil;
+    }
+
+    /**
+     * @brief Returns the number of elements in the window.
+     */
+    size_t size() const { return count; }
+
+    /**
+     * @brief Maximum number of elements kept.
+     */
+    size_t capacity() const { return ring.size(); }
+
+    /**
+     * @brief Returns the k-th smallest element (0-based). O(log N).
+     * @throws std::out_of_range If k >= size().
+     */
+    const T& nthSmallest(size_t k) const {
+        if (k >= count) throw std::out_of_range("Index out of range");
+        return pool[nthNode(k)].value;
+    }
+
+    /**
+     * @throws std::runtime_error If the window is empty.
+     */
+    const T& min() const { requireNonEmpty(); return pool[nthNode(0)].value; }
+
+    /**
+     * @throws std::runtime_error If the window is empty.
+     */
+    const T& max() const { requireNonEmpty(); return pool[nthNode(count - 1)].value; }
+
+    /**
+     * @brief Lower median: the value at sorted position (n - 1) / 2. O(log N).
+     * @throws std::runtime_error If the window is empty.
+     */
+    const T& median() const { requireNonEmpty(); return pool[nthNode((count - 1) / 2)].value; }
+
+    /// Window in insertion order (oldest first).
+    using Order = WindowOrder<false>;
+    /// Window in reverse insertion order (newest first).
+    using ReverseOrder = WindowOrder<true>;
+    /// Window from smallest to largest (equal elements oldest first).
+    using AscendingOrder = TreeOrder<false>;
+    /// Window from largest to smallest (the reverse of AscendingOrder).
+    using DescendingOrder = TreeOrder<true>;
+};
+
+} // namespace my_container_project
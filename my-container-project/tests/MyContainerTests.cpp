@@ -1,9 +1,51 @@
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include "doctest (1).h"
 #include "MyContainer.hpp"
+#include "MappedMyContainer.hpp"
+#include "ExternalMyContainer.hpp"
+#include "DurableMyContainer.hpp"
+#include "CompressedMyContainer.hpp"
+#include "DictionaryMyContainer.hpp"
+#include "ArenaMyContainer.hpp"
+#include "SmallMyContainer.hpp"
+#include "StaticMyContainer.hpp"
+#include "SoAMyContainer.hpp"
+#include "WindowedMyContainer.hpp"
+#include "Aggregates.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <memory_resource>
+#include <new>
+#include <random>
 #include <string>
+#include <thread>
+
+#include <sys/resource.h>
+
 using namespace my_container_project;
 
+// Counts global operator new calls, for the allocation-free paths
+static size_t heapAllocations = 0;
+
+void* operator new(std::size_t size) {
+    ++heapAllocations;
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
 TEST_CASE("Add, Remove, Size, Output - int") {
     MyContainer<int> c;
     CHECK(c.size() == 0);
@@ -759,4 +801,1897 @@ TEST_CASE("MiddleOutOrder Iterator - mixed string container") {
     for (auto it = middleOutIterator.begin(); it != middleOutIterator.end(); ++it, ++index) {
         CHECK(*it == expectedOrder[index]);
     }
-}
\ No newline at end of file
+}
+
+#if defined(__cpp_impl_coroutine)
+TEST_CASE("Generators - insertion, reverse and middle-out order") {
+    MyContainer<int> c;
+    c.addElement(7); c.addElement(15); c.addElement(6); c.addElement(1); c.addElement(2);
+
+    std::vector<int> order, reverse, middleOut;
+    for (const int& v : c.orderGenerator()) order.push_back(v);
+    for (const int& v : c.reverseOrderGenerator()) reverse.push_back(v);
+    for (const int& v : c.middleOutGenerator()) middleOut.push_back(v);
+
+    CHECK(order == std::vector<int>{7, 15, 6, 1, 2});
+    CHECK(reverse == std::vector<int>{2, 1, 6, 15, 7});
+    CHECK(middleOut == std::vector<int>{6, 15, 1, 7, 2});
+}
+
+TEST_CASE("Generators - sorted orders match iterator classes") {
+    MyContainer<int> c;
+    c.addElement(7); c.addElement(15); c.addElement(6); c.addElement(1); c.addElement(2); c.addElement(6);
+
+    std::vector<int> asc, lazyAsc, desc, cross;
+    for (const int& v : c.ascendingGenerator()) asc.push_back(v);
+    for (const int& v : c.lazyAscendingGenerator()) lazyAsc.push_back(v);
+    for (const int& v : c.descendingGenerator()) desc.push_back(v);
+    for (const int& v : c.sideCrossGenerator()) cross.push_back(v);
+
+    CHECK(asc == std::vector<int>{1, 2, 6, 6, 7, 15});
+    CHECK(lazyAsc == asc);
+    CHECK(desc == std::vector<int>{15, 7, 6, 6, 2, 1});
+    CHECK(cross == std::vector<int>{1, 15, 2, 7, 6, 6});
+}
+
+TEST_CASE("Generators - empty container and early exit") {
+    MyContainer<std::string> empty;
+    CHECK(empty.middleOutGenerator().begin() == std::default_sentinel);
+    CHECK(empty.lazyAscendingGenerator().begin() == std::default_sentinel);
+
+    MyContainer<int> c;
+    for (int i = 100; i > 0; --i) c.addElement(i);
+    auto gen = c.lazyAscendingGenerator();
+    auto it = gen.begin();
+    CHECK(*it == 1);
+    ++it;
+    CHECK(*it == 2);
+}
+#endif
+
+/**
+ * @brief Fresh directory under the system temp directory for file fixtures,
+ *        removed with its contents when the test ends.
+ */
+struct TempDir {
+    std::filesystem::path path;
+
+    TempDir() {
+        std::string pattern = (std::filesystem::temp_directory_path() / "my_container_test_XXXXXX").string();
+        if (!mkdtemp(pattern.data())) throw std::runtime_error("Cannot create temporary directory");
+        path = pattern;
+    }
+
+    ~TempDir() {
+        std::error_code ec;
+        std::filesystem::remove_all(path, ec);
+    }
+
+    TempDir(const TempDir&) = delete;
+    TempDir& operator=(const TempDir&) = delete;
+
+    std::string file(const std::string& name) const { return (path / name).string(); }
+};
+
+TEST_CASE("Binary save/load - round trip") {
+    TempDir tmp;
+    const std::string intPath = tmp.file("roundtrip_int.bin");
+    MyContainer<int> ints;
+    for (int i = 0; i < 1000; ++i) ints.addElement((i * 37) % 101 - 50);
+    ints.save(intPath);
+    MyContainer<int> loadedInts;
+    loadedInts.addElement(99);
+    loadedInts.load(intPath);
+    CHECK(loadedInts.getElements() == ints.getElements());
+
+    const std::string doublePath = tmp.file("roundtrip_double.bin");
+    MyContainer<double> doubles;
+    doubles.addElement(1.1); doubles.addElement(-2.5); doubles.addElement(1e300);
+    doubles.save(doublePath);
+    MyContainer<double> loadedDoubles;
+    loadedDoubles.load(doublePath);
+    CHECK(loadedDoubles.getElements() == doubles.getElements());
+
+    const std::string stringPath = tmp.file("roundtrip_string.bin");
+    MyContainer<std::string> strings;
+    strings.addElement("hello"); strings.addElement(""); strings.addElement("with space");
+    strings.save(stringPath);
+    MyContainer<std::string> loadedStrings;
+    loadedStrings.load(stringPath);
+    CHECK(loadedStrings.getElements() == strings.getElements());
+
+    MyContainer<int> empty;
+    empty.save(intPath);
+    loadedInts.load(intPath);
+    CHECK(loadedInts.size() == 0);
+}
+
+TEST_CASE("Binary save/load - errors") {
+    TempDir tmp;
+    MyContainer<int> c;
+    CHECK_THROWS_AS(c.load(tmp.file("does_not_exist.bin")), std::runtime_error);
+
+    MyContainer<double> doubles;
+    doubles.addElement(1.5);
+    doubles.save(tmp.file("typed.bin"));
+    CHECK_THROWS_AS(c.load(tmp.file("typed.bin")), std::runtime_error);
+
+    std::ofstream(tmp.file("garbage.bin")) << "not a container file at all, just text";
+    CHECK_THROWS_AS(c.load(tmp.file("garbage.bin")), std::runtime_error);
+
+    c.addElement(1); c.addElement(2); c.addElement(3);
+    c.save(tmp.file("truncated.bin"));
+    std::ifstream in(tmp.file("truncated.bin"), std::ios::binary);
+    std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    std::ofstream(tmp.file("truncated.bin"), std::ios::binary).write(bytes.data(), static_cast<std::streamsize>(bytes.size() - 2));
+    MyContainer<int> target;
+    target.addElement(7);
+    CHECK_THROWS_AS(target.load(tmp.file("truncated.bin")), std::runtime_error);
+    CHECK(target.size() == 1);
+}
+
+TEST_CASE("MappedMyContainer - views match MyContainer") {
+    TempDir tmp;
+    for (int n = 0; n <= 9; ++n) {
+        MyContainer<int> c;
+        for (int i = 0; i < n; ++i) c.addElement((i * 7) % 5 + i);
+        c.save(tmp.file("mapped.bin"));
+        MappedMyContainer<int> mapped(tmp.file("mapped.bin"));
+        CHECK(mapped.size() == c.size());
+
+        std::vector<int> expected, actual;
+        for (const auto& v : MyContainer<int>::Order(c)) expected.push_back(v);
+        for (const auto& v : MappedMyContainer<int>::Order(mapped)) actual.push_back(v);
+        CHECK(actual == expected);
+
+        expected.clear(); actual.clear();
+        MyContainer<int>::ReverseOrder rev(c);
+        for (auto it = rev.begin(); it != rev.end(); ++it) expected.push_back(*it);
+        for (const auto& v : MappedMyContainer<int>::ReverseOrder(mapped)) actual.push_back(v);
+        CHECK(actual == expected);
+
+        expected.clear(); actual.clear();
+        for (const auto& v : MyContainer<int>::MiddleOutOrder(c)) expected.push_back(v);
+        for (const auto& v : MappedMyContainer<int>::MiddleOutOrder(mapped)) actual.push_back(v);
+        CHECK(actual == expected);
+
+        expected.clear(); actual.clear();
+        for (const auto& v : MyContainer<int>::AscendingOrder(c)) expected.push_back(v);
+        for (const auto& v : MappedMyContainer<int>::AscendingOrder(mapped)) actual.push_back(v);
+        CHECK(actual == expected);
+
+        expected.clear(); actual.clear();
+        for (const auto& v : MyContainer<int>::DescendingOrder(c)) expected.push_back(v);
+        for (const auto& v : MappedMyContainer<int>::DescendingOrder(mapped)) actual.push_back(v);
+        CHECK(actual == expected);
+
+        expected.clear(); actual.clear();
+        for (const auto& v : MyContainer<int>::SideCrossOrder(c)) expected.push_back(v);
+        for (const auto& v : MappedMyContainer<int>::SideCrossOrder(mapped)) actual.push_back(v);
+        CHECK(actual == expected);
+    }
+}
+
+TEST_CASE("MappedMyContainer - errors and move") {
+    TempDir tmp;
+    CHECK_THROWS_AS(MappedMyContainer<int>(tmp.file("does_not_exist.bin")), std::runtime_error);
+
+    MyContainer<double> doubles;
+    doubles.addElement(2.5);
+    doubles.save(tmp.file("mapped_double.bin"));
+    CHECK_THROWS_AS(MappedMyContainer<int>(tmp.file("mapped_double.bin")), std::runtime_error);
+
+    MappedMyContainer<double> a(tmp.file("mapped_double.bin"));
+    MappedMyContainer<double> b(std::move(a));
+    CHECK(a.size() == 0);
+    CHECK(b.size() == 1);
+    CHECK(b[0] == 2.5);
+}
+
+TEST_CASE("Sorted index - cached per generation") {
+    MyContainer<int> c;
+    c.addElement(3); c.addElement(1); c.addElement(2);
+    CHECK_FALSE(c.hasCachedSortedIndex());
+    CHECK(c.getSortedIndex() == std::vector<size_t>{1, 2, 0});
+    CHECK(c.hasCachedSortedIndex());
+    uint64_t before = c.getGeneration();
+    c.addElement(0);
+    CHECK(c.getGeneration() > before);
+    CHECK_FALSE(c.hasCachedSortedIndex());
+    CHECK(c.getSortedIndex() == std::vector<size_t>{3, 1, 2, 0});
+    c.remove(1);
+    CHECK(c.getSortedIndex() == std::vector<size_t>{2, 1, 0});
+}
+
+TEST_CASE("Sorted index - persisted with save and restored by load") {
+    TempDir tmp;
+    MyContainer<int> c;
+    for (int v : {5, 3, 9, 1, 3, 7}) c.addElement(v);
+    c.save(tmp.file("indexed.bin"), true);
+
+    MyContainer<int> loaded;
+    loaded.load(tmp.file("indexed.bin"));
+    CHECK(loaded.getGeneration() == c.getGeneration());
+    CHECK(loaded.hasCachedSortedIndex());
+    CHECK(loaded.getSortedIndex() == c.getSortedIndex());
+    std::vector<int> asc;
+    for (const auto& v : MyContainer<int>::AscendingOrder(loaded)) asc.push_back(v);
+    CHECK(asc == std::vector<int>{1, 3, 3, 5, 7, 9});
+    std::vector<int> cross;
+    for (const auto& v : MyContainer<int>::SideCrossOrder(loaded)) cross.push_back(v);
+    CHECK(cross == std::vector<int>{1, 9, 3, 7, 3, 5});
+
+    c.save(tmp.file("unindexed.bin"));
+    loaded.load(tmp.file("unindexed.bin"));
+    CHECK_FALSE(loaded.hasCachedSortedIndex());
+
+    MyContainer<std::string> strings;
+    strings.addElement("pear"); strings.addElement("apple"); strings.addElement("fig");
+    strings.save(tmp.file("indexed_strings.bin"), true);
+    MyContainer<std::string> loadedStrings;
+    loadedStrings.load(tmp.file("indexed_strings.bin"));
+    CHECK(loadedStrings.hasCachedSortedIndex());
+    CHECK(loadedStrings.getSortedIndex() == std::vector<size_t>{1, 2, 0});
+}
+
+TEST_CASE("Sorted index - used in place by MappedMyContainer") {
+    TempDir tmp;
+    MyContainer<double> c;
+    for (double v : {2.5, -1.0, 8.25, 0.5}) c.addElement(v);
+    c.save(tmp.file("mapped_indexed.bin"), true);
+    MappedMyContainer<double> mapped(tmp.file("mapped_indexed.bin"));
+    CHECK(mapped.hasPersistedSortedIndex());
+    CHECK(mapped.getGeneration() == c.getGeneration());
+    std::vector<double> desc;
+    for (const auto& v : MappedMyContainer<double>::DescendingOrder(mapped)) desc.push_back(v);
+    CHECK(desc == std::vector<double>{8.25, 2.5, 0.5, -1.0});
+
+    c.save(tmp.file("mapped_unindexed.bin"));
+    MappedMyContainer<double> plain(tmp.file("mapped_unindexed.bin"));
+    CHECK_FALSE(plain.hasPersistedSortedIndex());
+
+    // Modify the container and save again, then splice the first file's
+    // index (stamped with the old generation) behind the new header and payload
+    c.remove(-1.0);
+    c.addElement(9.5);
+    c.save(tmp.file("mapped_current.bin"), true);
+    auto bytesOf = [](const std::string& path) {
+        std::ifstream in(path, std::ios::binary);
+        return std::string((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    };
+    const std::string current = bytesOf(tmp.file("mapped_current.bin"));
+    const std::string old = bytesOf(tmp.file("mapped_indexed.bin"));
+    const size_t indexOffset = static_cast<size_t>(binary_format::sortedIndexOffset(4 * sizeof(double)));
+    REQUIRE(current.size() == old.size());
+    std::ofstream(tmp.file("mapped_stale.bin"), std::ios::binary) << current.substr(0, indexOffset) << old.substr(indexOffset);
+
+    MappedMyContainer<double> stale(tmp.file("mapped_stale.bin"));
+    CHECK(stale.getGeneration() == c.getGeneration());
+    CHECK_FALSE(stale.hasPersistedSortedIndex());
+    std::vector<double> asc;
+    for (const auto& v : MappedMyContainer<double>::AscendingOrder(stale)) asc.push_back(v);
+    CHECK(asc == std::vector<double>{0.5, 2.5, 8.25, 9.5});
+
+    MyContainer<double> loaded;
+    loaded.load(tmp.file("mapped_stale.bin"));
+    CHECK_FALSE(loaded.hasCachedSortedIndex());
+    asc.clear();
+    for (const auto& v : MyContainer<double>::AscendingOrder(loaded)) asc.push_back(v);
+    CHECK(asc == std::vector<double>{0.5, 2.5, 8.25, 9.5});
+
+    // Swap two index entries: still a permutation with a matching generation,
+    // but no longer sorted, so the index is dropped rather than trusted
+    std::string unsorted = current;
+    std::swap_ranges(unsorted.begin() + indexOffset + 8, unsorted.begin() + indexOffset + 16,
+                     unsorted.begin() + indexOffset + 16);
+    std::ofstream(tmp.file("mapped_unsorted.bin"), std::ios::binary) << unsorted;
+    MappedMyContainer<double> edited(tmp.file("mapped_unsorted.bin"));
+    CHECK_FALSE(edited.hasPersistedSortedIndex());
+    asc.clear();
+    for (const auto& v : MappedMyContainer<double>::AscendingOrder(edited)) asc.push_back(v);
+    CHECK(asc == std::vector<double>{0.5, 2.5, 8.25, 9.5});
+    loaded.load(tmp.file("mapped_unsorted.bin"));
+    CHECK_FALSE(loaded.hasCachedSortedIndex());
+    asc.clear();
+    for (const auto& v : MyContainer<double>::AscendingOrder(loaded)) asc.push_back(v);
+    CHECK(asc == std::vector<double>{0.5, 2.5, 8.25, 9.5});
+
+    // Ties must keep position order, as getSortedIndex() builds them
+    MyContainer<int> ties;
+    for (int v : {3, 1, 3}) ties.addElement(v);
+    std::vector<int> values(ties.getElements().begin(), ties.getElements().end());
+    CHECK(binary_format::isSortedPermutation(values, ties.getSortedIndex().begin(), ties.getSortedIndex().end()));
+    std::vector<size_t> swappedTies{1, 2, 0};
+    CHECK_FALSE(binary_format::isSortedPermutation(values, swappedTies.begin(), swappedTies.end()));
+}
+
+template<typename T>
+static std::string slowFormat(const MyContainer<T>& c) {
+    std::ostringstream oss;
+    for (const auto& el : c.getElements()) oss << el << " ";
+    return oss.str();
+}
+
+TEST_CASE("Fast text output - byte-identical to ostream formatting") {
+    MyContainer<int> ints;
+    for (int v : {0, -1, 42, std::numeric_limits<int>::min(), std::numeric_limits<int>::max()}) ints.addElement(v);
+    std::ostringstream intOut;
+    intOut << ints;
+    CHECK(intOut.str() == slowFormat(ints));
+
+    MyContainer<double> doubles;
+    for (double v : {0.0, -0.0, 0.1, 1.0 / 3, 2.2, 1e300, 1e-5, 123456789.0, 1e6, 999999.5, -7.25e-12})
+        doubles.addElement(v);
+    std::ostringstream doubleOut;
+    doubleOut << doubles;
+    CHECK(doubleOut.str() == slowFormat(doubles));
+
+    MyContainer<unsigned char> bytes;
+    bytes.addElement('a'); bytes.addElement('Z');
+    std::ostringstream byteOut;
+    byteOut << bytes;
+    CHECK(byteOut.str() == "a Z ");
+
+    MyContainer<long long> many;
+    for (long long i = 0; i < 20000; ++i) many.addElement(i * 1000003 - 5000000000LL);
+    std::ostringstream manyOut;
+    manyOut << many;
+    CHECK(manyOut.str() == slowFormat(many));
+
+    MyContainer<std::string> strings;
+    strings.addElement("hello"); strings.addElement(std::string(100000, 'x')); strings.addElement("");
+    std::ostringstream stringOut;
+    stringOut << strings;
+    CHECK(stringOut.str() == slowFormat(strings));
+}
+
+TEST_CASE("Fast text output - non-default stream formatting falls back") {
+    MyContainer<int> c;
+    c.addElement(255); c.addElement(16);
+    std::ostringstream hexOut;
+    hexOut << std::hex << c;
+    CHECK(hexOut.str() == "ff 10 ");
+
+    MyContainer<double> d;
+    d.addElement(1.0 / 3);
+    std::ostringstream precise;
+    precise.precision(10);
+    precise << d;
+    CHECK(precise.str() == "0.3333333333 ");
+}
+
+TEST_CASE("Fast text output - writeTo FILE* and fd") {
+    MyContainer<double> c;
+    c.addElement(1.5); c.addElement(-2.0); c.addElement(1e20);
+    const std::string expected = slowFormat(c);
+
+    std::FILE* f = std::tmpfile();
+    REQUIRE(f != nullptr);
+    c.writeTo(f);
+    std::fflush(f);
+    std::rewind(f);
+    char buf[128] = {};
+    size_t n = std::fread(buf, 1, sizeof(buf), f);
+    CHECK(std::string(buf, n) == expected);
+
+    std::FILE* g = std::tmpfile();
+    REQUIRE(g != nullptr);
+    c.writeTo(fileno(g));
+    std::rewind(g);
+    n = std::fread(buf, 1, sizeof(buf), g);
+    CHECK(std::string(buf, n) == expected);
+    std::fclose(f);
+    std::fclose(g);
+}
+
+TEST_CASE("Text load - round trips operator<< output") {
+    MyContainer<int> ints;
+    for (int v : {7, -15, 0, std::numeric_limits<int>::min(), std::numeric_limits<int>::max()}) ints.addElement(v);
+    std::stringstream intText;
+    intText << ints;
+    MyContainer<int> parsedInts;
+    parsedInts.loadText(intText);
+    CHECK(parsedInts.getElements() == ints.getElements());
+
+    MyContainer<std::string> strings;
+    strings.addElement("alpha"); strings.addElement("beta");
+    std::stringstream stringText;
+    stringText << strings;
+    MyContainer<std::string> parsedStrings;
+    parsedStrings.addElement("first");
+    parsedStrings.loadText(stringText);
+    CHECK(parsedStrings.getElements() == std::vector<std::string>{"first", "alpha", "beta"});
+
+    MyContainer<char> chars;
+    std::istringstream charText("x z\ny");
+    chars.loadText(charText);
+    CHECK(chars.getElements() == std::vector<char>{'x', 'z', 'y'});
+}
+
+TEST_CASE("Text load - newline delimited file spanning several blocks") {
+    TempDir tmp;
+    const std::string path = tmp.file("values.txt");
+    std::vector<double> expected;
+    {
+        std::ofstream out(path);
+        out.precision(17);
+        for (int i = 0; i < 300000; ++i) {
+            double v = i * 0.5 - 1000.25;
+            expected.push_back(v);
+            out << v << (i % 3 ? "\n" : " \t\r\n");
+        }
+    }
+    MyContainer<double> c;
+    c.loadText(path);
+    CHECK(c.getElements() == expected);
+
+    std::istringstream signs("+5 -3 1e3 -2.5E-1");
+    MyContainer<double> parsed;
+    parsed.loadText(signs);
+    CHECK(parsed.getElements() == std::vector<double>{5, -3, 1000, -0.25});
+}
+
+TEST_CASE("Text load - malformed input leaves container unchanged") {
+    TempDir tmp;
+    MyContainer<int> c;
+    c.addElement(1);
+    uint64_t generation = c.getGeneration();
+    std::istringstream bad("2 3 four 5");
+    CHECK_THROWS_AS(c.loadText(bad), std::runtime_error);
+    CHECK(c.getElements() == std::vector<int>{1});
+    CHECK(c.getGeneration() == generation);
+
+    std::istringstream overflow("99999999999");
+    CHECK_THROWS_AS(c.loadText(overflow), std::runtime_error);
+    CHECK_THROWS_AS(c.loadText(tmp.file("does_not_exist.txt")), std::runtime_error);
+}
+
+TEST_CASE("ExternalMyContainer - sorted views merge spilled runs") {
+    TempDir tmp;
+    ExternalMyContainer<int> c(100, 8, tmp.path.string());
+    std::vector<int> expected;
+    unsigned state = 12345;
+    for (int i = 0; i < 5000; ++i) {
+        state = state * 1103515245u + 12345u;
+        int v = static_cast<int>(state >> 16) % 1000 - 500;
+        c.addElement(v);
+        expected.push_back(v);
+    }
+    CHECK(c.size() == 5000);
+    CHECK(c.runCount() == 50);
+    std::sort(expected.begin(), expected.end());
+
+    std::vector<int> asc;
+    ExternalMyContainer<int>::AscendingOrder ascending(c);
+    for (auto it = ascending.begin(); it != ascending.end(); ++it) asc.push_back(*it);
+    CHECK(asc == expected);
+    CHECK(c.runCount() <= 12); // Extra merge passes keep the fan-in within the budget
+
+    std::vector<int> desc;
+    for (const auto& v : ExternalMyContainer<int>::DescendingOrder(c)) desc.push_back(v);
+    std::reverse(expected.begin(), expected.end());
+    CHECK(desc == expected);
+}
+
+TEST_CASE("ExternalMyContainer - merges stay within the memory budget") {
+    TempDir tmp;
+    for (size_t budget : {9, 30, 64, 100}) {
+        for (size_t block : {1, 3, 8, 4096}) {
+            ExternalMyContainer<int> c(budget, block, tmp.path.string());
+            for (int i = 0; i < 3000; ++i) c.addElement((i * 7919) % 1009);
+            size_t count = 0;
+            int previous = std::numeric_limits<int>::min();
+            bool sorted = true;
+            for (const auto& v : ExternalMyContainer<int>::AscendingOrder(c)) {
+                sorted = sorted && previous <= v;
+                previous = v;
+                ++count;
+            }
+            CHECK(sorted);
+            CHECK(count == 3000);
+            CHECK(c.peakMemoryElements() <= budget);
+        }
+    }
+}
+
+TEST_CASE("ExternalMyContainer - small and empty containers") {
+    ExternalMyContainer<double> empty(16);
+    ExternalMyContainer<double>::AscendingOrder none(empty);
+    CHECK(none.begin() == none.end());
+
+    ExternalMyContainer<double> c(16);
+    c.addElement(2.5); c.addElement(-1.0); c.addElement(0.5);
+    CHECK(c.runCount() == 0);
+    std::vector<double> asc;
+    for (const auto& v : ExternalMyContainer<double>::AscendingOrder(c)) asc.push_back(v);
+    CHECK(asc == std::vector<double>{-1.0, 0.5, 2.5});
+
+    c.addElement(1.0);
+    std::vector<double> desc;
+    for (const auto& v : ExternalMyContainer<double>::DescendingOrder(c)) desc.push_back(v);
+    CHECK(desc == std::vector<double>{2.5, 1.0, 0.5, -1.0});
+
+    CHECK_THROWS_AS(ExternalMyContainer<int>(0), std::invalid_argument);
+
+    // Views merge the buffer from memory, so interleaving them with adds creates no runs
+    TempDir tmp;
+    ExternalMyContainer<int> interleaved(100, 8, tmp.path.string());
+    std::vector<int> expected;
+    for (int round = 0; round < 7; ++round) {   // Up to 70 buffered: three 8-element blocks still fit
+        for (int i = 0; i < 10; ++i) {
+            interleaved.addElement((round * 37 + i * 11) % 50);
+            expected.push_back((round * 37 + i * 11) % 50);
+        }
+        std::vector<int> seen;
+        for (const auto& v : ExternalMyContainer<int>::DescendingOrder(interleaved)) seen.push_back(v);
+        std::vector<int> sorted = expected;
+        std::sort(sorted.rbegin(), sorted.rend());
+        CHECK(seen == sorted);
+        CHECK(interleaved.runCount() == 0);
+    }
+    for (int i = 0; i < 35; ++i) interleaved.addElement(1000 + i);   // 105: one run of 100 spilled, 5 buffered
+    CHECK(interleaved.runCount() == 1);
+    std::vector<int> merged;
+    for (const auto& v : ExternalMyContainer<int>::AscendingOrder(interleaved)) merged.push_back(v);
+    CHECK(merged.size() == 105);
+    CHECK(std::is_sorted(merged.begin(), merged.end()));
+    CHECK(interleaved.runCount() == 1);
+}
+
+static std::string readFileBytes(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    return std::string((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+}
+
+static std::vector<int> durableElements(const std::string& snapshot, const std::string& log) {
+    DurableMyContainer<int> d(snapshot, log);
+    return d.container().getElements();
+}
+
+TEST_CASE("DurableMyContainer - replays the log after reopening") {
+    TempDir tmp;
+    const std::string snapshot = tmp.file("wal_replay.snap"), log = tmp.file("wal_replay.log");
+    {
+        DurableMyContainer<int> d(snapshot, log);
+        d.addElement(1); d.addElement(2); d.addElement(3); d.addElement(2);
+        d.remove(2);
+        CHECK_THROWS_AS(d.remove(42), std::runtime_error);
+        CHECK(d.pendingCount() == 5);
+        d.sync();
+        CHECK(d.pendingCount() == 0);
+    }
+    CHECK(durableElements(snapshot, log) == std::vector<int>{1, 3});
+
+    WalOptions everyRecord;
+    everyRecord.maxPendingRecords = 1;
+    {
+        DurableMyContainer<int> d(snapshot, log, everyRecord);
+        d.addElement(4);
+        CHECK(d.pendingCount() == 0);
+    }
+    CHECK(durableElements(snapshot, log) == std::vector<int>{1, 3, 4});
+}
+
+TEST_CASE("DurableMyContainer - checkpoint and torn tail recovery") {
+    TempDir tmp;
+    const std::string snapshot = tmp.file("wal_ckpt.snap"), log = tmp.file("wal_ckpt.log");
+    std::string logBeforeCheckpoint;
+    {
+        DurableMyContainer<int> d(snapshot, log);
+        for (int i = 0; i < 10; ++i) d.addElement(i);
+        d.sync();
+        logBeforeCheckpoint = readFileBytes(log);
+        d.checkpoint();
+        CHECK(readFileBytes(log).empty());
+        d.addElement(100);
+    }
+    CHECK(durableElements(snapshot, log).size() == 11);
+
+    // Crash after installing the snapshot but before truncating the log:
+    // records already covered by the snapshot must not be applied twice.
+    std::ofstream(log, std::ios::binary | std::ios::trunc) << logBeforeCheckpoint;
+    CHECK(durableElements(snapshot, log).size() == 10);
+
+    // A torn final record is ignored and cut off.
+    {
+        DurableMyContainer<int> d(snapshot, log);
+        d.addElement(7);
+    }
+    std::string bytes = readFileBytes(log);
+    std::ofstream(log, std::ios::binary | std::ios::trunc).write(bytes.data(), static_cast<std::streamsize>(bytes.size() - 3));
+    std::vector<int> recovered = durableElements(snapshot, log);
+    CHECK(recovered.size() == 10);
+    CHECK(readFileBytes(log).size() < bytes.size() - 3);
+}
+
+TEST_CASE("DurableMyContainer - a failed log write leaves the state unchanged") {
+    TempDir tmp;
+    const std::string snapshot = tmp.file("wal_fail.snap"), log = tmp.file("wal_fail.log");
+    WalOptions everyRecord;
+    everyRecord.maxPendingRecords = 1;
+    DurableMyContainer<int> d(snapshot, log, everyRecord);
+    for (int i = 0; i < 3; ++i) d.addElement(i);
+    const size_t committed = readFileBytes(log).size();
+
+    // Cap the file size just past the log so the next record is cut short
+    struct rlimit saved;
+    REQUIRE(::getrlimit(RLIMIT_FSIZE, &saved) == 0);
+    auto previousHandler = std::signal(SIGXFSZ, SIG_IGN);
+    struct rlimit capped = saved;
+    capped.rlim_cur = static_cast<rlim_t>(committed + 5);
+    REQUIRE(::setrlimit(RLIMIT_FSIZE, &capped) == 0);
+    CHECK_THROWS_AS(d.addElement(99), std::runtime_error);
+    CHECK_THROWS_AS(d.remove(1), std::runtime_error);
+    ::setrlimit(RLIMIT_FSIZE, &saved);
+    std::signal(SIGXFSZ, previousHandler);
+
+    CHECK(d.container().getElements() == std::vector<int>{0, 1, 2});
+    CHECK(d.pendingCount() == 0);
+    CHECK(readFileBytes(log).size() == committed);
+    d.addElement(3);
+    CHECK(durableElements(snapshot, log) == std::vector<int>{0, 1, 2, 3});
+}
+
+TEST_CASE("DurableMyContainer - poll() commits records once maxPendingTime passes") {
+    TempDir tmp;
+    const std::string snapshot = tmp.file("wal_poll.snap"), log = tmp.file("wal_poll.log");
+    WalOptions options;
+    options.maxPendingRecords = 1000;
+    options.maxPendingTime = std::chrono::milliseconds(50);
+    DurableMyContainer<int> d(snapshot, log, options);
+    d.addElement(1);
+    CHECK_FALSE(d.poll());
+    CHECK(d.pendingCount() == 1);
+    CHECK(readFileBytes(log).empty());   // Idle: nothing else would commit it
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    CHECK(d.poll());
+    CHECK(d.pendingCount() == 0);
+    CHECK(durableElements(snapshot, log) == std::vector<int>{1});
+    CHECK_FALSE(d.poll());
+}
+
+TEST_CASE("DurableMyContainer - periodic checkpoints bound the log") {
+    TempDir tmp;
+    const std::string snapshot = tmp.file("wal_auto.snap"), log = tmp.file("wal_auto.log");
+    WalOptions byRecords;
+    byRecords.checkpointEveryRecords = 5;
+    {
+        DurableMyContainer<int> d(snapshot, log, byRecords);
+        for (int i = 0; i < 4; ++i) d.addElement(i);
+        d.sync();
+        CHECK_FALSE(std::filesystem::exists(snapshot));
+        CHECK_FALSE(readFileBytes(log).empty());
+        d.remove(0);   // Fifth record
+        CHECK(std::filesystem::exists(snapshot));
+        CHECK(readFileBytes(log).empty());
+        CHECK(d.pendingCount() == 0);
+        d.addElement(10);
+        d.addElement(11);
+    }
+    CHECK(durableElements(snapshot, log) == std::vector<int>{1, 2, 3, 10, 11});
+    {
+        DurableMyContainer<int> d(snapshot, log, byRecords);   // Replayed records count towards the limit
+        for (int i = 0; i < 3; ++i) d.addElement(20 + i);
+        CHECK(readFileBytes(log).empty());
+    }
+
+    WalOptions byBytes;
+    byBytes.maxPendingRecords = 1;
+    byBytes.checkpointLogBytes = 200;
+    const std::string snapshot2 = tmp.file("wal_bytes.snap"), log2 = tmp.file("wal_bytes.log");
+    DurableMyContainer<int> d(snapshot2, log2, byBytes);
+    size_t largestLog = 0;
+    for (int i = 0; i < 100; ++i) {
+        d.addElement(i);
+        largestLog = std::max(largestLog, readFileBytes(log2).size());
+    }
+    CHECK(largestLog < 200);
+    CHECK(std::filesystem::exists(snapshot2));
+    CHECK(durableElements(snapshot2, log2).size() == 100);
+}
+
+TEST_CASE("DurableMyContainer - string elements") {
+    TempDir tmp;
+    const std::string snapshot = tmp.file("wal_str.snap"), log = tmp.file("wal_str.log");
+    {
+        DurableMyContainer<std::string> d(snapshot, log);
+        d.addElement("alpha"); d.addElement(""); d.addElement("gamma");
+        d.remove("alpha");
+    }
+    DurableMyContainer<std::string> d(snapshot, log);
+    CHECK(d.container().getElements() == std::vector<std::string>{"", "gamma"});
+}
+
+TEST_CASE("CompressedMyContainer - views match uncompressed data") {
+    CompressedMyContainer<int> c;
+    std::vector<int> expected;
+    unsigned state = 7;
+    for (int i = 0; i < 1000; ++i) {
+        state = state * 1103515245u + 12345u;
+        int v = 100000 + i * 3 + static_cast<int>((state >> 16) % 50); // Clustered, slowly rising
+        if (i == 500) v = -2000000000;
+        c.addElement(v);
+        expected.push_back(v);
+    }
+    CHECK(c.size() == expected.size());
+    CHECK(c.decompress() == expected);
+
+    std::vector<int> order;
+    for (const auto& v : CompressedMyContainer<int>::Order(c)) order.push_back(v);
+    CHECK(order == expected);
+
+    std::vector<int> reverse;
+    for (const auto& v : CompressedMyContainer<int>::ReverseOrder(c)) reverse.push_back(v);
+    CHECK(reverse == std::vector<int>(expected.rbegin(), expected.rend()));
+
+    std::vector<int> sorted = expected;
+    std::sort(sorted.begin(), sorted.end());
+    std::vector<int> asc;
+    for (const auto& v : CompressedMyContainer<int>::AscendingOrder(c)) asc.push_back(v);
+    CHECK(asc == sorted);
+    std::vector<int> desc;
+    for (const auto& v : CompressedMyContainer<int>::DescendingOrder(c)) desc.push_back(v);
+    CHECK(desc == std::vector<int>(sorted.rbegin(), sorted.rend()));
+}
+
+TEST_CASE("CompressedMyContainer - compression ratio on small values") {
+    CompressedMyContainer<int> c;
+    for (int i = 0; i < 100000; ++i) c.addElement(i % 200);
+    CHECK(c.memoryUsage() * 3 < c.size() * sizeof(int));
+    CompressedMyContainer<int>::AscendingOrder asc(c);
+    CHECK(asc.memoryUsage() * 8 < c.size() * sizeof(int));
+}
+
+TEST_CASE("CompressedMyContainer - extremes, remove and empty") {
+    CompressedMyContainer<long long> c;
+    CompressedMyContainer<long long>::Order none(c);
+    CHECK(none.begin() == none.end());
+
+    std::vector<long long> values = {std::numeric_limits<long long>::min(), 0, std::numeric_limits<long long>::max(), -1};
+    for (int i = 0; i < 70; ++i)
+        for (long long v : values) c.addElement(v);
+    std::vector<long long> asc;
+    for (const auto& v : CompressedMyContainer<long long>::AscendingOrder(c)) asc.push_back(v);
+    CHECK(std::is_sorted(asc.begin(), asc.end()));
+    CHECK(asc.front() == std::numeric_limits<long long>::min());
+    CHECK(asc.back() == std::numeric_limits<long long>::max());
+
+    c.remove(0);
+    CHECK(c.size() == 210);
+    CHECK_THROWS_AS(c.remove(0), std::runtime_error);
+    std::vector<long long> order;
+    for (const auto& v : CompressedMyContainer<long long>::Order(c)) order.push_back(v);
+    CHECK(order[0] == std::numeric_limits<long long>::min());
+    CHECK(order[1] == std::numeric_limits<long long>::max());
+    CHECK(order[2] == -1);
+}
+
+TEST_CASE("DictionaryMyContainer - interning and views") {
+    DictionaryMyContainer c;
+    std::vector<std::string> input = {"web-02", "db-01", "web-01", "db-01", "web-02", "cache", "web-01"};
+    for (const auto& s : input) c.addElement(s);
+    CHECK(c.size() == input.size());
+    CHECK(c.distinctCount() == 4);
+    CHECK(c.getCodes() == std::vector<uint32_t>{0, 1, 2, 1, 0, 3, 2});
+    CHECK(c.valueOf(3) == "cache");
+
+    std::vector<std::string> order;
+    for (const auto& s : DictionaryMyContainer::Order(c)) order.push_back(s);
+    CHECK(order == input);
+
+    std::vector<std::string> reverse;
+    for (const auto& s : DictionaryMyContainer::ReverseOrder(c)) reverse.push_back(s);
+    CHECK(reverse == std::vector<std::string>(input.rbegin(), input.rend()));
+
+    std::vector<std::string> sorted = input;
+    std::sort(sorted.begin(), sorted.end());
+    std::vector<std::string> asc;
+    for (const auto& s : DictionaryMyContainer::AscendingOrder(c)) asc.push_back(s);
+    CHECK(asc == sorted);
+
+    c.addElement("alpha"); // New value after ranking: ranks are rebuilt
+    std::vector<std::string> desc;
+    for (const auto& s : DictionaryMyContainer::DescendingOrder(c)) desc.push_back(s);
+    CHECK(desc.front() == "web-02");
+    CHECK(desc.back() == "alpha");
+    CHECK(desc.size() == 8);
+}
+
+TEST_CASE("DictionaryMyContainer - remove") {
+    DictionaryMyContainer c;
+    c.addElement("a"); c.addElement("b"); c.addElement("a");
+    c.remove("a");
+    CHECK(c.size() == 1);
+    CHECK_THROWS_AS(c.remove("a"), std::runtime_error);
+    CHECK_THROWS_AS(c.remove("never added"), std::runtime_error);
+    c.addElement("a");
+    CHECK(c.getCodes() == std::vector<uint32_t>{1, 0});
+}
+
+TEST_CASE("DictionaryMyContainer - move") {
+    auto make = [](std::initializer_list<const char*> words) {
+        DictionaryMyContainer c;
+        for (const char* w : words) c.addElement(w);
+        DictionaryMyContainer::AscendingOrder warm(c); // Populates the rank cache before moving
+        return c;
+    };
+    std::vector<DictionaryMyContainer> all;
+    for (int i = 0; i < 20; ++i) all.push_back(make({"pear", "fig", "pear"})); // Reallocates, moving each element
+    DictionaryMyContainer& c = all.front();
+    c.addElement("fig");   // Interned values still found through the moved map
+    c.addElement("apple");
+    CHECK(c.getCodes() == std::vector<uint32_t>{0, 1, 0, 1, 2});
+    std::vector<std::string> asc;
+    for (const auto& s : DictionaryMyContainer::AscendingOrder(c)) asc.emplace_back(s);
+    CHECK(asc == std::vector<std::string>{"apple", "fig", "fig", "pear", "pear"});
+
+    DictionaryMyContainer other = make({"kiwi"});
+    other = std::move(all.back());
+    other.remove("fig");
+    CHECK(other.size() == 2);
+    CHECK(other.getCodes() == std::vector<uint32_t>{0, 0});
+}
+
+TEST_CASE("ArenaMyContainer - views and prefix ordering") {
+    ArenaMyContainer c(64);
+    std::vector<std::string> input = {"abcdefgh-2", "abcdefgh-10", "", "abc", "abc\xff", "zz", std::string(100, 'q'), "abcdefgh"};
+    for (const auto& s : input) c.addElement(s);
+    CHECK(c.size() == input.size());
+    CHECK(c.at(1) == "abcdefgh-10");
+
+    std::vector<std::string> order;
+    for (auto s : ArenaMyContainer::Order(c)) order.emplace_back(s);
+    CHECK(order == input);
+
+    std::vector<std::string> reverse;
+    for (auto s : ArenaMyContainer::ReverseOrder(c)) reverse.emplace_back(s);
+    CHECK(reverse == std::vector<std::string>(input.rbegin(), input.rend()));
+
+    std::vector<std::string> sorted = input;
+    std::sort(sorted.begin(), sorted.end());
+    std::vector<std::string> asc;
+    for (auto s : ArenaMyContainer::AscendingOrder(c)) asc.emplace_back(s);
+    CHECK(asc == sorted);
+
+    std::vector<std::string> desc;
+    for (auto s : ArenaMyContainer::DescendingOrder(c)) desc.emplace_back(s);
+    CHECK(desc == std::vector<std::string>(sorted.rbegin(), sorted.rend()));
+}
+
+TEST_CASE("ArenaMyContainer - few allocations and remove") {
+    ArenaMyContainer c;
+    c.reserve(100000);
+    for (int i = 0; i < 100000; ++i) c.addElement("host-" + std::to_string(i % 977));
+    CHECK(c.blockCount() == 1);
+    CHECK(c.arenaSize() == ArenaMyContainer::kDefaultBlockSize);
+
+    size_t before = c.size();
+    c.remove("host-5");
+    CHECK(c.size() < before);
+    CHECK_THROWS_AS(c.remove("host-5"), std::runtime_error);
+}
+
+namespace {
+
+/**
+ * @brief Memory resource counting the allocations routed through it.
+ */
+class CountingResource : public std::pmr::memory_resource {
+public:
+    explicit CountingResource(std::pmr::memory_resource* up) : upstream(up) {}
+    size_t allocations = 0;
+private:
+    std::pmr::memory_resource* upstream;
+    void* do_allocate(size_t bytes, size_t align) override { ++allocations; return upstream->allocate(bytes, align); }
+    void do_deallocate(void* p, size_t bytes, size_t align) override { upstream->deallocate(p, bytes, align); }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+} // namespace
+
+TEST_CASE("Allocator-aware - pmr container and views use the request resource") {
+    alignas(std::max_align_t) static char buffer[1 << 16];
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+    CountingResource counting(&arena);
+    std::pmr::memory_resource* previous = std::pmr::set_default_resource(std::pmr::null_memory_resource());
+
+    std::vector<int> asc, desc, cross, mid;
+    {
+        pmr::MyContainer<int> c{std::pmr::polymorphic_allocator<int>(&counting)};
+        for (int v : {7, 15, 6, 1, 2}) c.addElement(v);
+        for (const auto& v : pmr::MyContainer<int>::AscendingOrder(c)) asc.push_back(v);
+        for (const auto& v : pmr::MyContainer<int>::DescendingOrder(c)) desc.push_back(v);
+        for (const auto& v : pmr::MyContainer<int>::SideCrossOrder(c)) cross.push_back(v);
+        for (const auto& v : pmr::MyContainer<int>::MiddleOutOrder(c)) mid.push_back(v);
+        CHECK(c.get_allocator().resource() == &counting);
+    }
+    std::pmr::set_default_resource(previous);
+
+    CHECK(counting.allocations > 0);
+    CHECK(asc == std::vector<int>{1, 2, 6, 7, 15});
+    CHECK(desc == std::vector<int>{15, 7, 6, 2, 1});
+    CHECK(cross == std::vector<int>{1, 15, 2, 7, 6});
+    CHECK(mid == std::vector<int>{6, 15, 1, 7, 2});
+}
+
+TEST_CASE("Allocator-aware - view buffer from a separate allocator") {
+    MyContainer<std::string, std::pmr::polymorphic_allocator<std::string>> c;
+    c.addElement("b"); c.addElement("a");
+    std::pmr::monotonic_buffer_resource perView;
+    CountingResource counting(&perView);
+    MyContainer<std::string, std::pmr::polymorphic_allocator<std::string>>::AscendingOrder asc(
+        c, std::pmr::polymorphic_allocator<std::string>(&counting));
+    CHECK(*asc.begin() == "a");
+    CHECK(counting.allocations > 0);
+}
+
+TEST_CASE("SmallMyContainer - sorting network matches std::sort") {
+    for (size_t n = 0; n <= 33; ++n) {
+        std::vector<int> values(n);
+        for (size_t i = 0; i < n; ++i) values[i] = static_cast<int>((i * 7919) % 13) - 6;
+        std::vector<int> expected = values;
+        std::sort(expected.begin(), expected.end());
+        sortingNetwork(values.data(), values.size());
+        CHECK(values == expected);
+    }
+
+    // 0-1 principle: a comparator network sorts every input iff it sorts every 0/1 input
+    for (size_t n = 0; n <= 16; ++n) {
+        size_t failures = 0;
+        for (uint32_t bits = 0; bits < (uint32_t(1) << n); ++bits) {
+            int values[16];
+            for (size_t i = 0; i < n; ++i) values[i] = static_cast<int>((bits >> i) & 1);
+            sortingNetwork(values, n);
+            failures += !std::is_sorted(values, values + n);
+        }
+        CHECK(failures == 0);
+    }
+
+    // Every permutation of distinct values and of values with duplicates
+    for (size_t n = 0; n <= 8; ++n) {
+        for (int duplicates = 0; duplicates < 2; ++duplicates) {
+            std::vector<int> perm(n);
+            for (size_t i = 0; i < n; ++i) perm[i] = static_cast<int>(duplicates ? i / 2 : i);
+            size_t failures = 0;
+            do {
+                std::vector<int> values = perm;
+                sortingNetwork(values.data(), n);
+                failures += !std::is_sorted(values.begin(), values.end());
+            } while (std::next_permutation(perm.begin(), perm.end()));
+            CHECK(failures == 0);
+        }
+    }
+    std::vector<std::string> words{"pear", "fig", "apple", "fig", "kiwi", "date"};
+    std::sort(words.begin(), words.end());
+    do {
+        std::vector<std::string> values = words;
+        sortingNetwork(values.data(), values.size());
+        REQUIRE(std::is_sorted(values.begin(), values.end()));
+    } while (std::next_permutation(words.begin(), words.end()));
+}
+
+TEST_CASE("SmallMyContainer - no heap allocation while inline") {
+    constexpr size_t N = 16;
+    using Small = SmallMyContainer<int, N>;
+    for (size_t n = 0; n <= N; ++n) {
+        const size_t before = heapAllocations;
+        long long sum = 0;
+        {
+            Small c;
+            for (size_t i = 0; i < n; ++i) c.addElement(static_cast<int>((i * 37) % 11));
+            for (const auto& v : Small::Order(c)) sum += v;
+            for (const auto& v : Small::ReverseOrder(c)) sum += v;
+            for (const auto& v : Small::AscendingOrder(c)) sum += v;
+            for (const auto& v : Small::DescendingOrder(c)) sum += v;
+            for (const auto& v : Small::SideCrossOrder(c)) sum += v;
+            for (const auto& v : Small::MiddleOutOrder(c)) sum += v;
+        }
+        const size_t allocations = heapAllocations - before;
+        CHECK(allocations == 0);
+        long long expected = 0;
+        for (size_t i = 0; i < n; ++i) expected += static_cast<long long>((i * 37) % 11);
+        CHECK(sum == 6 * expected);
+    }
+
+    const size_t before = heapAllocations;
+    Small spilled;
+    for (size_t i = 0; i <= N; ++i) spilled.addElement(static_cast<int>(i));
+    CHECK(heapAllocations - before > 0);   // The counter does see the spill
+}
+
+TEST_CASE("SmallMyContainer - inline views and spill to the heap") {
+    SmallMyContainer<int, 8> c;
+    for (int v : {7, 15, 6, 1, 2}) c.addElement(v);
+    CHECK(c.isInline());
+
+    std::vector<int> order, reverse, asc, desc, cross, mid;
+    for (const auto& v : SmallMyContainer<int, 8>::Order(c)) order.push_back(v);
+    for (const auto& v : SmallMyContainer<int, 8>::ReverseOrder(c)) reverse.push_back(v);
+    for (const auto& v : SmallMyContainer<int, 8>::AscendingOrder(c)) asc.push_back(v);
+    for (const auto& v : SmallMyContainer<int, 8>::DescendingOrder(c)) desc.push_back(v);
+    for (const auto& v : SmallMyContainer<int, 8>::SideCrossOrder(c)) cross.push_back(v);
+    for (const auto& v : SmallMyContainer<int, 8>::MiddleOutOrder(c)) mid.push_back(v);
+    CHECK(order == std::vector<int>{7, 15, 6, 1, 2});
+    CHECK(reverse == std::vector<int>{2, 1, 6, 15, 7});
+    CHECK(asc == std::vector<int>{1, 2, 6, 7, 15});
+    CHECK(desc == std::vector<int>{15, 7, 6, 2, 1});
+    CHECK(cross == std::vector<int>{1, 15, 2, 7, 6});
+    CHECK(mid == std::vector<int>{6, 15, 1, 7, 2});
+
+    for (int v = 20; v < 30; ++v) c.addElement(v);
+    CHECK_FALSE(c.isInline());
+    CHECK(c.size() == 15);
+    asc.clear();
+    for (const auto& v : SmallMyContainer<int, 8>::AscendingOrder(c)) asc.push_back(v);
+    CHECK(asc.front() == 1);
+    CHECK(asc.back() == 29);
+    CHECK(std::is_sorted(asc.begin(), asc.end()));
+
+    c.remove(15);
+    CHECK(c.size() == 14);
+    CHECK_THROWS_AS(c.remove(15), std::runtime_error);
+
+    SmallMyContainer<int, 4> empty;
+    SmallMyContainer<int, 4>::ReverseOrder emptyReverse(empty);
+    SmallMyContainer<int, 4>::MiddleOutOrder emptyMiddle(empty);
+    CHECK(emptyReverse.begin() == emptyReverse.end());
+    CHECK(emptyMiddle.begin() == emptyMiddle.end());
+}
+
+namespace {
+
+/**
+ * @brief constexpr element-wise comparison (std::array::operator== is not constexpr in C++17).
+ */
+template<typename View, typename T, size_t N>
+constexpr bool viewEquals(const View& view, const std::array<T, N>& expected) {
+    size_t i = 0;
+    for (const auto& v : view) {
+        if (i >= N || !(v == expected[i])) return false;
+        ++i;
+    }
+    return i == N;
+}
+
+constexpr StaticMyContainer kStaticTable{7, 15, 6, 1, 2};
+
+} // namespace
+
+TEST_CASE("StaticMyContainer - orders computed at compile time") {
+    using Table = decltype(kStaticTable);
+    static_assert(kStaticTable.size() == 5);
+    static_assert(kStaticTable.at(1) == 15);
+    static_assert(viewEquals(Table::Order(kStaticTable), std::array<int, 5>{7, 15, 6, 1, 2}));
+    static_assert(viewEquals(Table::ReverseOrder(kStaticTable), std::array<int, 5>{2, 1, 6, 15, 7}));
+    static_assert(viewEquals(Table::AscendingOrder(kStaticTable), std::array<int, 5>{1, 2, 6, 7, 15}));
+    static_assert(viewEquals(Table::DescendingOrder(kStaticTable), std::array<int, 5>{15, 7, 6, 2, 1}));
+    static_assert(viewEquals(Table::SideCrossOrder(kStaticTable), std::array<int, 5>{1, 15, 2, 7, 6}));
+    static_assert(viewEquals(Table::MiddleOutOrder(kStaticTable), std::array<int, 5>{6, 15, 1, 7, 2}));
+
+    static constexpr Table::AscendingOrder asc(kStaticTable);
+    std::vector<int> runtime;
+    for (const auto& v : asc) runtime.push_back(v);
+    CHECK(runtime == std::vector<int>{1, 2, 6, 7, 15});
+    CHECK(asc.values().back() == 15);
+}
+
+TEST_CASE("StaticMyContainer - even, single and empty tables") {
+    constexpr StaticMyContainer<double, 4> even{3.5, -1.0, 2.0, 0.5};
+    static_assert(viewEquals(StaticMyContainer<double, 4>::MiddleOutOrder(even), std::array<double, 4>{-1.0, 3.5, 2.0, 0.5}));
+    static_assert(viewEquals(StaticMyContainer<double, 4>::SideCrossOrder(even), std::array<double, 4>{-1.0, 3.5, 0.5, 2.0}));
+
+    constexpr StaticMyContainer single{42};
+    static_assert(viewEquals(decltype(single)::MiddleOutOrder(single), std::array<int, 1>{42}));
+
+    constexpr StaticMyContainer<int, 0> empty;
+    static_assert(empty.size() == 0);
+    static_assert(viewEquals(StaticMyContainer<int, 0>::AscendingOrder(empty), std::array<int, 0>{}));
+    CHECK_THROWS_AS(empty.at(0), std::out_of_range);
+}
+
+TEST_CASE("StaticMyContainer - iterator API and narrowing") {
+    using Table = decltype(kStaticTable);
+    static_assert(std::is_constructible<StaticMyContainer<int, 2>, int, int>::value);
+    static_assert(std::is_constructible<StaticMyContainer<long, 2>, long, int>::value);
+    static_assert(!std::is_constructible<StaticMyContainer<int, 2>, int, double>::value);
+    static_assert(!std::is_constructible<StaticMyContainer<int, 2>, int, long>::value);
+
+    static constexpr Table::AscendingOrder asc(kStaticTable);   // 1 2 6 7 15
+    static_assert(asc.begin()[2] == 6);
+    static_assert(*(asc.begin() + 4) == 15);
+    static_assert(*(asc.end() - 1) == 15);
+    auto it = asc.end();
+    --it;
+    CHECK(*it-- == 15);
+    CHECK(*it == 7);
+    CHECK(it[0] == 7);
+    CHECK((asc.begin() + 5) == asc.end());
+    CHECK_THROWS_AS(*asc.end(), std::out_of_range);
+    CHECK_THROWS_AS(asc.begin()[5], std::out_of_range);
+}
+
+namespace {
+
+struct Reading {
+    long timestamp;
+    int id;
+    double value;
+    bool operator==(const Reading& other) const { return timestamp == other.timestamp && id == other.id; }
+    bool operator<(const Reading& other) const { return timestamp < other.timestamp; }
+};
+
+} // namespace
+
+TEST_CASE("Sorted views - comparator and projection") {
+    MyContainer<Reading> c;
+    c.addElement({30, 2, 0.5});
+    c.addElement({10, 1, 2.5});
+    c.addElement({20, 2, -1.0});
+    c.addElement({10, 3, 0.0});
+
+    std::vector<int> ids;
+    for (const auto& r : c.ascendingBy({}, &Reading::value)) ids.push_back(r.id);
+    CHECK(ids == std::vector<int>{2, 3, 2, 1});
+
+    ids.clear();
+    for (const auto& r : c.ascendingBy(std::greater<>(), &Reading::id)) ids.push_back(r.id);
+    CHECK(ids == std::vector<int>{3, 2, 2, 1});
+
+    std::vector<long> stamps;
+    for (const auto& r : c.descendingBy({}, [](const Reading& r) { return r.timestamp; })) stamps.push_back(r.timestamp);
+    CHECK(stamps == std::vector<long>{30, 20, 10, 10});
+
+    ids.clear();
+    MyContainer<Reading>::SideCrossOrderBy<std::less<>, int Reading::*> cross(c, {}, &Reading::id);
+    for (const auto& r : cross) ids.push_back(r.id);
+    CHECK(ids == std::vector<int>{1, 3, 2, 2});
+
+    // Defaults still go through the cached index; custom orderings do not touch it.
+    MyContainer<Reading>::AscendingOrder asc(c);
+    CHECK(c.hasCachedSortedIndex());
+    CHECK((*asc.begin()).id == 1);
+}
+
+TEST_CASE("Sorted views - radix and key-extraction paths match std::stable_sort") {
+    MyContainer<int> ints;
+    std::vector<int> values;
+    for (int i = 0; i < 5000; ++i) {
+        int v = static_cast<int>((i * 2654435761u) % 20001) - 10000;
+        if (i % 7 == 0) v = std::numeric_limits<int>::min() + i % 3;
+        values.push_back(v);
+        ints.addElement(v);
+    }
+    std::vector<int> expected = values;
+    std::stable_sort(expected.begin(), expected.end());
+    std::vector<int> got;
+    for (const auto& v : MyContainer<int>::AscendingOrder(ints)) got.push_back(v);
+    CHECK(got == expected);
+
+    got.clear();
+    for (const auto& v : ints.ascendingBy(std::greater<int>())) got.push_back(v);
+    CHECK(got == std::vector<int>(expected.rbegin(), expected.rend()));
+
+    // Stability of equal projected keys on the radix path.
+    MyContainer<Reading> readings;
+    for (int i = 0; i < 1000; ++i) readings.addElement({static_cast<long>(i % 10), i, 0.0});
+    std::vector<Reading> byStamp;
+    for (const auto& r : readings.descendingBy({}, &Reading::timestamp)) byStamp.push_back(r);
+    CHECK(byStamp.front().timestamp == 9);
+    CHECK(byStamp.front().id == 999);
+    CHECK(byStamp.back().timestamp == 0);
+    CHECK(byStamp.back().id == 0);
+
+    std::vector<Reading> greaterStamp;
+    for (const auto& r : readings.ascendingBy(std::greater<>(), &Reading::timestamp)) greaterStamp.push_back(r);
+    CHECK(greaterStamp.front().id == 9);
+    CHECK(greaterStamp.back().id == 990);
+
+    // Floating-point keys use key extraction without radix.
+    MyContainer<double> doubles;
+    for (double d : {2.5, -0.0, 1.0, 0.0, -3.0}) doubles.addElement(d);
+    std::vector<double> sortedDoubles;
+    for (const auto& d : doubles.ascendingBy()) sortedDoubles.push_back(d);
+    CHECK(sortedDoubles == std::vector<double>{-3.0, -0.0, 0.0, 1.0, 2.5});
+    CHECK(std::signbit(sortedDoubles[1]));
+}
+
+TEST_CASE("SoAMyContainer - columns and sorted views") {
+    using Readings = SoAMyContainer<Reading, &Reading::timestamp, &Reading::id, &Reading::value>;
+    Readings c;
+    c.addElement({30, 2, 0.5});
+    c.addElement({10, 1, 2.5});
+    c.addElement({20, 2, -1.0});
+    c.addElement({10, 3, 0.0});
+    CHECK(c.size() == 4);
+    CHECK(c.column<0>() == std::vector<long>{30, 10, 20, 10});
+    CHECK(c.column<2>() == std::vector<double>{0.5, 2.5, -1.0, 0.0});
+
+    std::vector<int> ids;
+    for (auto row : Readings::Order(c)) ids.push_back(row.get<1>());
+    CHECK(ids == std::vector<int>{2, 1, 2, 3});
+
+    ids.clear();
+    for (auto row : Readings::ReverseOrder(c)) ids.push_back(row.get<1>());
+    CHECK(ids == std::vector<int>{3, 2, 1, 2});
+
+    ids.clear();
+    for (auto row : Readings::AscendingOrder<0>(c)) ids.push_back(row.get<1>());
+    CHECK(ids == std::vector<int>{1, 3, 2, 2});
+
+    std::vector<double> values;
+    for (auto row : Readings::DescendingOrder<2>(c)) values.push_back(row.get<2>());
+    CHECK(values == std::vector<double>{2.5, 0.5, 0.0, -1.0});
+
+    Reading r = c.at(2).materialize();
+    CHECK(r.timestamp == 20);
+    CHECK(r.id == 2);
+    CHECK(r.value == -1.0);
+    CHECK_THROWS_AS(c.at(4), std::out_of_range);
+}
+
+TEST_CASE("SoAMyContainer - remove keeps columns aligned") {
+    SoAMyContainer<Reading, &Reading::timestamp, &Reading::id> c;
+    c.addElement({1, 1, 9.0});
+    c.addElement({2, 2, 9.0});
+    c.addElement({1, 1, 7.0}); // value is not a column, so this row matches too
+    c.addElement({3, 3, 9.0});
+    c.remove({1, 1, 0.0});
+    CHECK(c.size() == 2);
+    CHECK(c.column<0>() == std::vector<long>{2, 3});
+    CHECK(c.column<1>() == std::vector<int>{2, 3});
+    CHECK(c.at(1).materialize().value == 0.0);
+    CHECK_THROWS_AS(c.remove({1, 1, 0.0}), std::runtime_error);
+}
+
+TEST_CASE("Aggregates - kernels agree across instruction sets") {
+    std::vector<int> ints;
+    std::vector<float> floats;
+    std::vector<double> doubles;
+    for (int i = 0; i < 1003; ++i) {
+        int v = static_cast<int>((i * 2654435761u) % 100001) - 50000;
+        ints.push_back(v);
+        floats.push_back(static_cast<float>(v) / 8);
+        doubles.push_back(static_cast<double>(v) / 3);
+    }
+    ints[517] = std::numeric_limits<int>::max();
+    ints[518] = std::numeric_limits<int>::min();
+
+    int64_t intSum = 0;
+    for (int v : ints) intSum += v;
+    double doubleSum = 0;
+    for (double v : doubles) doubleSum += v;
+
+    for (aggregates::Isa isa : {aggregates::Isa::Scalar, aggregates::Isa::Sse2, aggregates::Isa::Avx2}) {
+        aggregates::ScopedIsaLimit limit(isa);
+        for (size_t n : {size_t(1), size_t(7), size_t(8), size_t(9), ints.size()}) {
+            auto lo = std::min_element(ints.begin(), ints.begin() + n);
+            auto hi = std::max_element(ints.begin(), ints.begin() + n);
+            CHECK(aggregates::minmax(aggregates::span(ints.data(), n)) == std::make_pair(*lo, *hi));
+            CHECK(aggregates::min(aggregates::span(floats.data(), n)) == *std::min_element(floats.begin(), floats.begin() + n));
+            CHECK(aggregates::max(aggregates::span(doubles.data(), n)) == *std::max_element(doubles.begin(), doubles.begin() + n));
+        }
+        CHECK(aggregates::sum(ints) == intSum);
+        CHECK(aggregates::sum(doubles) == doctest::Approx(doubleSum));
+        CHECK(aggregates::sum(floats) == doctest::Approx(doubleSum * 3 / 8));
+        CHECK(aggregates::mean(doubles) == doctest::Approx(doubleSum / doubles.size()));
+
+        double m = doubleSum / doubles.size(), sq = 0;
+        for (double v : doubles) sq += (v - m) * (v - m);
+        CHECK(aggregates::variance(doubles) == doctest::Approx(sq / doubles.size()));
+    }
+
+    // The cap is scoped and per thread: other threads keep the detected instruction set.
+    {
+        aggregates::ScopedIsaLimit scalar(aggregates::Isa::Scalar);
+        CHECK(aggregates::activeIsa() == aggregates::Isa::Scalar);
+        aggregates::Isa other = aggregates::Isa::Scalar;
+        std::thread([&] { other = aggregates::activeIsa(); }).join();
+        CHECK(other == aggregates::detectIsa());
+    }
+    CHECK(aggregates::activeIsa() == aggregates::detectIsa());
+}
+
+TEST_CASE("Aggregates - containers, views and permutations") {
+    MyContainer<int> c;
+    for (int v : {7, 15, 6, 1, 2}) c.addElement(v);
+    CHECK(aggregates::sum(c) == 31);
+    CHECK(aggregates::minmax(c) == std::make_pair(1, 15));
+    CHECK(aggregates::mean(c) == doctest::Approx(6.2));
+    CHECK(aggregates::variance(c) == doctest::Approx(24.56));
+    CHECK(aggregates::max(MyContainer<int>::AscendingOrder(c)) == 15);
+    CHECK(aggregates::sum(MyContainer<int>::MiddleOutOrder(c)) == 31);
+    CHECK(aggregates::min(aggregates::gather(c.getElements().data(), c.getSortedIndex().data(), c.size())) == 1);
+
+    std::vector<double> big(5000);
+    std::vector<size_t> perm(big.size());
+    for (size_t i = 0; i < big.size(); ++i) {
+        big[i] = static_cast<double>(i);
+        perm[i] = (i * 7919) % big.size();
+    }
+    CHECK(aggregates::sum(aggregates::gather(big.data(), perm.data(), perm.size())) == doctest::Approx(4999.0 * 5000 / 2));
+    CHECK(aggregates::minmax(aggregates::gather(big.data(), perm.data(), perm.size())) == std::make_pair(0.0, 4999.0));
+
+    MyContainer<long long> wide;
+    wide.addElement(1LL << 40);
+    wide.addElement(-3);
+    CHECK(aggregates::sum(wide) == (1LL << 40) - 3);
+
+    MyContainer<int> empty;
+    CHECK(aggregates::sum(empty) == 0);
+    CHECK_THROWS_AS(aggregates::min(empty), std::runtime_error);
+    CHECK_THROWS_AS(aggregates::mean(empty), std::runtime_error);
+
+    // aggregates::min()/max() on a container are the container's own min()/max().
+    CHECK_THROWS_WITH_AS(aggregates::max(empty), "Container is empty", std::runtime_error);
+    CHECK_THROWS_WITH_AS(empty.max(), "Container is empty", std::runtime_error);
+    c.enableOrderStatistics();
+    c.addElement(-4);
+    CHECK(aggregates::min(c) == c.min());
+    CHECK(aggregates::max(c) == c.max());
+    MyContainer<std::string> words;
+    for (const char* w : {"pear", "fig", "apple"}) words.addElement(w);
+    CHECK(words.min() == "apple");
+    CHECK(words.max() == "pear");
+}
+
+TEST_CASE("Order statistics - tracked min, max and median") {
+    MyContainer<int> c;
+    c.enableOrderStatistics();
+    CHECK(c.tracksOrderStatistics());
+    CHECK_THROWS_AS(c.median(), std::runtime_error);
+
+    std::vector<int> values;
+    for (int i = 0; i < 200; ++i) {
+        int v = static_cast<int>((i * 7919) % 101) - 50;
+        c.addElement(v);
+        values.push_back(v);
+        std::vector<int> sorted = values;
+        std::sort(sorted.begin(), sorted.end());
+        CHECK(c.min() == sorted.front());
+        CHECK(c.max() == sorted.back());
+        CHECK(c.median() == sorted[(sorted.size() - 1) / 2]);
+    }
+
+    for (int v : {-50, 50, 0, 13}) {
+        c.remove(v);
+        values.erase(std::remove(values.begin(), values.end(), v), values.end());
+        std::vector<int> sorted = values;
+        std::sort(sorted.begin(), sorted.end());
+        CHECK(c.min() == sorted.front());
+        CHECK(c.max() == sorted.back());
+        CHECK(c.median() == sorted[(sorted.size() - 1) / 2]);
+    }
+
+    std::istringstream more("1000 -1000");
+    c.loadText(more);
+    CHECK(c.min() == -1000);
+    CHECK(c.max() == 1000);
+}
+
+TEST_CASE("Order statistics - untracked fallbacks") {
+    TempDir tmp;
+    MyContainer<int> c;
+    CHECK_THROWS_AS(c.min(), std::runtime_error);
+    CHECK_THROWS_AS(c.max(), std::runtime_error);
+    CHECK_THROWS_AS(c.median(), std::runtime_error);
+    for (int v : {7, 15, 6, 1, 2, 9}) c.addElement(v);
+    CHECK_FALSE(c.tracksOrderStatistics());
+    CHECK(c.min() == 1);
+    CHECK(c.max() == 15);
+    CHECK(c.median() == 6);
+    c.getSortedIndex();
+    CHECK(c.median() == 6);
+    CHECK(c.max() == 15);
+
+    c.enableOrderStatistics();
+    CHECK(c.median() == 6);
+    c.save(tmp.file("order_stats.bin"));
+    MyContainer<int> loaded;
+    loaded.enableOrderStatistics();
+    loaded.addElement(99);
+    loaded.load(tmp.file("order_stats.bin"));
+    CHECK(loaded.max() == 15);
+    CHECK(loaded.median() == 6);
+    loaded.disableOrderStatistics();
+    CHECK(loaded.min() == 1);
+}
+
+TEST_CASE("Quantile sketch - accuracy, determinism and merge") {
+    KllSketch<int> a, b, whole;
+    for (int i = 0; i < 200000; ++i) {
+        int v = static_cast<int>((i * 2654435761u) % 1000000);
+        (i % 2 ? a : b).update(v);
+        whole.update(v);
+    }
+    CHECK(whole.size() == 200000);
+    CHECK(whole.retainedCount() < 2000);
+    const double eps = whole.normalizedRankError();
+    for (double q : {0.01, 0.25, 0.5, 0.9, 0.99}) {
+        CHECK(std::abs(whole.quantile(q) / 1e6 - q) < eps);
+        CHECK(std::abs(whole.rank(static_cast<int>(q * 1e6)) - q) < eps);
+    }
+    a.merge(b);
+    CHECK(a.size() == 200000);
+    CHECK(std::abs(a.rank(500000) - 0.5) < eps);
+
+    KllSketch<int> again;
+    for (int i = 0; i < 200000; ++i) again.update(static_cast<int>((i * 2654435761u) % 1000000));
+    CHECK(again.quantile(0.5) == whole.quantile(0.5));
+
+    KllSketch<int> small(16);
+    CHECK_THROWS_AS(a.merge(small), std::invalid_argument);
+    CHECK_THROWS_AS(small.quantile(0.5), std::runtime_error);
+    CHECK_THROWS_AS(whole.quantile(1.5), std::invalid_argument);
+    CHECK_THROWS_AS(KllSketch<int>(4), std::invalid_argument);
+}
+
+TEST_CASE("Quantile sketch - attached to MyContainer") {
+    MyContainer<int> c;
+    for (int i = 1; i <= 1000; ++i) c.addElement(i);
+    CHECK(c.approxQuantile(0.5) == 500);   // No sketch: exact
+    CHECK(c.approxQuantile(0.0) == 1);
+    CHECK(c.approxQuantile(1.0) == 1000);
+    CHECK(c.approxRank(250) == doctest::Approx(0.25));
+
+    c.enableQuantileSketch(64);
+    for (int i = 1001; i <= 100000; ++i) c.addElement(i);
+    const double eps = c.getQuantileSketch().normalizedRankError();
+    CHECK(std::abs(c.approxQuantile(0.5) / 100000.0 - 0.5) < eps);
+    CHECK(std::abs(c.approxRank(90000) - 0.9) < eps);
+
+    c.remove(100000);
+    CHECK(c.getQuantileSketch().size() == 99999);
+    CHECK(c.approxQuantile(1.0) >= 99000);
+
+    c.disableQuantileSketch();
+    CHECK_THROWS_AS(c.getQuantileSketch(), std::runtime_error);
+    CHECK(c.approxQuantile(1.0) == 99999);
+}
+
+TEST_CASE("Sketches - Bloom filter and HyperLogLog") {
+    BloomFilter<int> bloom(10000, 0.01);
+    for (int i = 0; i < 10000; ++i) bloom.insert(i * 2);
+    for (int i = 0; i < 10000; ++i) CHECK(bloom.mightContain(i * 2));
+    size_t falsePositives = 0;
+    for (int i = 0; i < 10000; ++i) falsePositives += bloom.mightContain(i * 2 + 1);
+    CHECK(falsePositives < 300);
+    CHECK_THROWS_AS(BloomFilter<int>(10, 1.5), std::invalid_argument);
+
+    HyperLogLog<std::string> hll, other;
+    for (int i = 0; i < 50000; ++i) (i < 30000 ? hll : other).insert("user-" + std::to_string(i % 40000));
+    CHECK(hll.estimate() == doctest::Approx(30000).epsilon(0.03));
+    hll.merge(other);
+    CHECK(hll.estimate() == doctest::Approx(40000).epsilon(0.03));
+    HyperLogLog<int> tiny(4);
+    for (int i = 0; i < 5; ++i) tiny.insert(7);
+    CHECK(tiny.estimate() == doctest::Approx(1).epsilon(0.5));
+    CHECK_THROWS_AS(hll.merge(HyperLogLog<std::string>(10)), std::invalid_argument);
+}
+
+TEST_CASE("Sketches - attached to MyContainer") {
+    MyContainer<int> c;
+    for (int i = 0; i < 100; ++i) c.addElement(i % 10);
+    CHECK(c.approxDistinct() == 10);   // No estimator: exact
+    CHECK(c.contains(3));
+    CHECK_FALSE(c.contains(42));
+
+    c.enableMembershipFilter(16);
+    c.enableDistinctCounter();
+    for (int i = 100; i < 5000; ++i) c.addElement(i);
+    CHECK(c.membershipFilterMemory() > 0);
+    for (int i = 100; i < 5000; i += 7) CHECK(c.contains(i));
+    CHECK_FALSE(c.contains(-1));
+    CHECK(c.approxDistinct() == doctest::Approx(4910).epsilon(0.03));
+
+    c.remove(3);
+    CHECK_FALSE(c.contains(3));
+    CHECK_THROWS_AS(c.remove(3), std::runtime_error);
+    CHECK_THROWS_AS(c.remove(-5), std::runtime_error);
+    CHECK(c.approxDistinct() == doctest::Approx(4909).epsilon(0.03));
+
+    c.disableMembershipFilter();
+    c.disableDistinctCounter();
+    CHECK(c.membershipFilterMemory() == 0);
+    CHECK(c.approxDistinct() == 4909);
+}
+
+TEST_CASE("Unique elements - set semantics") {
+    MyContainer<int> c;
+    for (int v : {4, 1, 4, 2, 1}) CHECK(c.addElement(v));
+    c.enableUniqueElements();
+    CHECK(c.enforcesUniqueElements());
+    CHECK(c.getElements() == std::vector<int>{4, 1, 2});   // First copies kept
+    CHECK_FALSE(c.addElement(2));
+    const uint64_t generation = c.getGeneration();
+    CHECK_FALSE(c.addElement(4));
+    CHECK(c.getGeneration() == generation);
+    CHECK(c.addElement(3));
+    CHECK(c.contains(3));
+    CHECK(c.approxDistinct() == 4);
+
+    c.remove(4);
+    CHECK_FALSE(c.contains(4));
+    CHECK_THROWS_AS(c.remove(4), std::runtime_error);
+    CHECK(c.addElement(4));
+
+    std::istringstream in("3 5 5 6");
+    c.loadText(in);
+    CHECK(c.getElements() == std::vector<int>{1, 2, 3, 4, 5, 6});
+
+    c.disableUniqueElements();
+    CHECK(c.addElement(6));
+    CHECK(c.size() == 7);
+}
+
+TEST_CASE("Unique elements - deduplicated sorted views") {
+    MyContainer<int> c;
+    for (int v : {5, 3, 5, 1, 3, 3, 9}) c.addElement(v);
+    std::vector<int> seen;
+    MyContainer<int>::UniqueAscendingOrder up(c);
+    for (int v : up) seen.push_back(v);
+    CHECK(seen == std::vector<int>{1, 3, 5, 9});
+    CHECK(up.size() == 4);
+    seen.clear();
+    MyContainer<int>::UniqueDescendingOrder down(c);
+    for (int v : down) seen.push_back(v);
+    CHECK(seen == std::vector<int>{9, 5, 3, 1});
+    CHECK(c.size() == 7);   // Views leave the container as is
+
+    MyContainer<Reading> r;
+    r.addElement({30, 2, 0.5});
+    r.addElement({10, 1, 1.5});
+    r.addElement({20, 2, 2.5});
+    r.addElement({40, 1, 3.5});
+    MyContainer<Reading>::UniqueAscendingOrderBy<std::less<>, int Reading::*> byId(r, {}, &Reading::id);
+    std::vector<long> firstPerId;
+    for (const Reading& x : byId) firstPerId.push_back(x.timestamp);
+    CHECK(firstPerId == std::vector<long>{10, 30});   // First inserted reading per id
+    MyContainer<Reading>::UniqueDescendingOrderBy<std::less<>, int Reading::*> byIdDown(r, {}, &Reading::id);
+    firstPerId.clear();
+    for (const Reading& x : byIdDown) firstPerId.push_back(x.timestamp);
+    CHECK(firstPerId == std::vector<long>{30, 10});
+}
+
+TEST_CASE("Set algebra - multiset semantics and streaming") {
+    MyContainer<int> a, b;
+    for (int v : {5, 1, 3, 3, 7, 9, 3}) a.addElement(v);
+    for (int v : {3, 4, 9, 1, 3, 10}) b.addElement(v);
+    CHECK(a.unionWith(b).getElements() == std::vector<int>{1, 3, 3, 3, 4, 5, 7, 9, 10});
+    CHECK(a.intersectWith(b).getElements() == std::vector<int>{1, 3, 3, 9});
+    CHECK(a.differenceWith(b).getElements() == std::vector<int>{3, 5, 7});
+    CHECK(b.differenceWith(a).getElements() == std::vector<int>{4, 10});
+    CHECK(a.symmetricDifference(b).getElements() == std::vector<int>{3, 4, 5, 7, 10});
+    CHECK(a.intersectWith(MyContainer<int>()).size() == 0);
+    CHECK(a.unionWith(a).getElements() == a.intersectWith(a).getElements());
+
+    MyContainer<int> u = a.unionWith(b);
+    CHECK(u.hasCachedSortedIndex());
+    std::vector<int> streamed;
+    a.intersectWith(b, [&streamed](int v) { streamed.push_back(v); });
+    CHECK(streamed == std::vector<int>{1, 3, 3, 9});
+
+    std::vector<std::string> words;
+    MyContainer<std::string> s1, s2;
+    for (const char* w : {"pear", "apple", "fig"}) s1.addElement(w);
+    for (const char* w : {"fig", "kiwi"}) s2.addElement(w);
+    s1.symmetricDifference(s2, [&words](const std::string& w) { words.push_back(w); });
+    CHECK(words == std::vector<std::string>{"apple", "kiwi", "pear"});
+}
+
+TEST_CASE("Set algebra - galloping and SIMD paths match std algorithms") {
+    std::mt19937 rng(7);
+    for (size_t small : {3u, 50u, 2000u}) {
+        MyContainer<int> big, few;
+        for (int i = 0; i < 5000; ++i) big.addElement(static_cast<int>(rng() % 8000));
+        for (size_t i = 0; i < small; ++i) few.addElement(static_cast<int>(rng() % 8000));
+        std::vector<int> x(big.getElements()), y(few.getElements()), expected;
+        std::sort(x.begin(), x.end());
+        std::sort(y.begin(), y.end());
+        std::set_union(x.begin(), x.end(), y.begin(), y.end(), std::back_inserter(expected));
+        CHECK(big.unionWith(few).getElements() == expected);
+        CHECK(few.unionWith(big).getElements() == expected);
+        expected.clear();
+        std::set_intersection(y.begin(), y.end(), x.begin(), x.end(), std::back_inserter(expected));
+        CHECK(few.intersectWith(big).getElements() == expected);
+        expected.clear();
+        std::set_difference(x.begin(), x.end(), y.begin(), y.end(), std::back_inserter(expected));
+        CHECK(big.differenceWith(few).getElements() == expected);
+        expected.clear();
+        std::set_difference(y.begin(), y.end(), x.begin(), x.end(), std::back_inserter(expected));
+        CHECK(few.differenceWith(big).getElements() == expected);
+        expected.clear();
+        std::set_symmetric_difference(x.begin(), x.end(), y.begin(), y.end(), std::back_inserter(expected));
+        CHECK(big.symmetricDifference(few).getElements() == expected);
+
+        big.enableUniqueElements();   // Distinct on both sides: block kernel
+        few.enableUniqueElements();
+        x.assign(big.getElements().begin(), big.getElements().end());
+        y.assign(few.getElements().begin(), few.getElements().end());
+        std::sort(x.begin(), x.end());
+        std::sort(y.begin(), y.end());
+        expected.clear();
+        std::set_intersection(x.begin(), x.end(), y.begin(), y.end(), std::back_inserter(expected));
+        CHECK(big.intersectWith(few).getElements() == expected);
+        aggregates::ScopedIsaLimit scalar(aggregates::Isa::Scalar);
+        CHECK(big.intersectWith(few).getElements() == expected);
+    }
+}
+
+TEST_CASE("Merge - moves elements and merges cached sorted indices") {
+    MyContainer<std::string> a, b;
+    for (const char* w : {"pear", "fig", "apple"}) a.addElement(w);
+    for (const char* w : {"kiwi", "fig", "banana"}) b.addElement(w);
+    a.getSortedIndex();
+    b.getSortedIndex();
+    a.merge(std::move(b));
+    CHECK(b.size() == 0);
+    CHECK(a.getElements() == std::vector<std::string>{"pear", "fig", "apple", "kiwi", "fig", "banana"});
+    CHECK(a.hasCachedSortedIndex());   // Merged, not re-sorted
+    CHECK(a.getSortedIndex() == std::vector<size_t>{2, 5, 1, 4, 3, 0});   // Stable: a's "fig" first
+
+    MyContainer<std::string> empty;
+    a.merge(std::move(empty));
+    CHECK(a.size() == 6);
+    const std::string* storage = a.getElements().data();
+    MyContainer<std::string> fresh;
+    fresh.merge(std::move(a));
+    CHECK(fresh.getElements().data() == storage);   // Took over the storage
+    CHECK(fresh.hasCachedSortedIndex());
+    CHECK(a.size() == 0);
+    CHECK_THROWS_AS(fresh.merge(std::move(fresh)), std::invalid_argument);
+
+    MyContainer<int> c, d;
+    c.addElement(1);
+    d.addElement(2);
+    c.merge(std::move(d));   // No cached index: sorted lazily
+    CHECK_FALSE(c.hasCachedSortedIndex());
+    CHECK(c.getElements() == std::vector<int>{1, 2});
+}
+
+TEST_CASE("Merge - trackers and unique elements stay consistent") {
+    MyContainer<int> a, b;
+    a.enableOrderStatistics();
+    a.enableQuantileSketch();
+    a.enableDistinctCounter();
+    a.enableMembershipFilter(16);
+    b.enableQuantileSketch();
+    b.enableDistinctCounter();
+    for (int i = 0; i < 1000; ++i) a.addElement(i);
+    for (int i = 1000; i < 3000; ++i) b.addElement(i);
+    a.merge(std::move(b));
+    CHECK(a.size() == 3000);
+    CHECK(a.max() == 2999);
+    CHECK(a.median() == 1499);
+    CHECK(a.getQuantileSketch().size() == 3000);
+    CHECK(std::abs(a.approxQuantile(0.5) - 1500) < 100);
+    CHECK(a.approxDistinct() == doctest::Approx(3000).epsilon(0.05));
+    CHECK(a.contains(2500));
+    CHECK(b.approxDistinct() == 0);
+    CHECK(b.getQuantileSketch().size() == 0);
+
+    MyContainer<int> u, v;
+    u.enableUniqueElements();
+    for (int x : {1, 2, 3}) u.addElement(x);
+    for (int x : {3, 4, 4}) v.addElement(x);
+    u.getSortedIndex();
+    v.getSortedIndex();
+    u.merge(std::move(v));
+    CHECK(u.getElements() == std::vector<int>{1, 2, 3, 4});
+    CHECK_FALSE(u.addElement(4));
+    std::vector<int> ascending;
+    for (int x : MyContainer<int>::AscendingOrder(u)) ascending.push_back(x);
+    CHECK(ascending == std::vector<int>{1, 2, 3, 4});
+}
+
+TEST_CASE("WindowedMyContainer - eviction and views") {
+    WindowedMyContainer<int> w(4);
+    CHECK_THROWS_AS(WindowedMyContainer<int>(0), std::invalid_argument);
+    CHECK_THROWS_AS(w.median(), std::runtime_error);
+    for (int v : {5, 1, 9, 3, 7, 2}) w.addElement(v);   // 5 and 1 evicted
+    CHECK(w.size() == 4);
+    CHECK(w.capacity() == 4);
+    std::vector<int> seen;
+    for (int v : WindowedMyContainer<int>::Order(w)) seen.push_back(v);
+    CHECK(seen == std::vector<int>{9, 3, 7, 2});
+    seen.clear();
+    for (int v : WindowedMyContainer<int>::ReverseOrder(w)) seen.push_back(v);
+    CHECK(seen == std::vector<int>{2, 7, 3, 9});
+    seen.clear();
+    for (int v : WindowedMyContainer<int>::AscendingOrder(w)) seen.push_back(v);
+    CHECK(seen == std::vector<int>{2, 3, 7, 9});
+    seen.clear();
+    for (int v : WindowedMyContainer<int>::DescendingOrder(w)) seen.push_back(v);
+    CHECK(seen == std::vector<int>{9, 7, 3, 2});
+    CHECK(w.min() == 2);
+    CHECK(w.max() == 9);
+    CHECK(w.median() == 3);
+    CHECK(w.nthSmallest(2) == 7);
+    CHECK_THROWS_AS(w.nthSmallest(4), std::out_of_range);
+
+    w.remove(3);
+    CHECK_THROWS_AS(w.remove(3), std::runtime_error);
+    w.addElement(4);
+    w.addElement(8);   // Window was 9 7 2 4; 9 evicted
+    seen.clear();
+    for (int v : WindowedMyContainer<int>::Order(w)) seen.push_back(v);
+    CHECK(seen == std::vector<int>{7, 2, 4, 8});
+    CHECK(w.median() == 4);
+    w.clear();
+    CHECK(w.size() == 0);
+}
+
+TEST_CASE("WindowedMyContainer - matches a re-sorted window") {
+    std::mt19937 rng(11);
+    WindowedMyContainer<int> w(50);
+    std::deque<int> window;
+    for (int step = 0; step < 2000; ++step) {
+        const int v = static_cast<int>(rng() % 100);   // Many duplicates
+        w.addElement(v);
+        window.push_back(v);
+        if (window.size() > 50) window.pop_front();
+        if (step % 97 == 0) {
+            w.remove(v);
+            window.erase(std::remove(window.begin(), window.end(), v), window.end());
+        }
+        std::vector<int> sorted(window.begin(), window.end());
+        std::sort(sorted.begin(), sorted.end());
+        REQUIRE(w.size() == sorted.size());
+        if (sorted.empty()) continue;
+        CHECK(w.median() == sorted[(sorted.size() - 1) / 2]);
+        CHECK(w.nthSmallest(step % sorted.size()) == sorted[step % sorted.size()]);
+    }
+    std::vector<int> ascending, order;
+    for (int v : WindowedMyContainer<int>::AscendingOrder(w)) ascending.push_back(v);
+    for (int v : WindowedMyContainer<int>::Order(w)) order.push_back(v);
+    std::vector<int> sorted(window.begin(), window.end());
+    std::sort(sorted.begin(), sorted.end());
+    CHECK(ascending == sorted);
+    CHECK(order == std::vector<int>(window.begin(), window.end()));
+}
+
+TEST_CASE("TimerWheel - fires every deadline once, across levels and jumps") {
+    TimerWheel wheel(10);
+    std::mt19937_64 rng(5);
+    std::vector<uint64_t> deadlines;
+    for (int i = 0; i < 3000; ++i) {
+        const uint64_t d = 10 + (rng() >> (4 + rng() % 60));   // Spread over many levels
+        deadlines.push_back(d);
+        wheel.schedule(d);
+    }
+    wheel.schedule(3);   // Already past: fires on the next advance
+    CHECK(wheel.pendingCount() == 3001);
+    CHECK_THROWS_AS(wheel.advance(9), std::invalid_argument);
+    std::sort(deadlines.begin(), deadlines.end());
+    uint64_t now = 10;
+    size_t fired = wheel.advance(now);
+    CHECK(fired == 1 + static_cast<size_t>(std::count(deadlines.begin(), deadlines.end(), uint64_t(10))));
+    for (uint64_t step : {uint64_t(1), uint64_t(63), uint64_t(64), uint64_t(4095), uint64_t(1) << 20, uint64_t(1) << 40}) {
+        now += step;
+        const auto expected = static_cast<size_t>(std::upper_bound(deadlines.begin(), deadlines.end(), now) - deadlines.begin()) + 1;
+        fired += wheel.advance(now);
+        CHECK(fired == expected);
+        CHECK(wheel.now() == now);
+    }
+    fired += wheel.advance(std::numeric_limits<uint64_t>::max());
+    CHECK(fired == 3001);
+    CHECK(wheel.pendingCount() == 0);
+    wheel.schedule(wheel.now());
+    wheel.clear();
+    CHECK(wheel.advance(wheel.now()) == 0);
+}
+
+TEST_CASE("TimerWheel - cancelled deadlines never fire") {
+    TimerWheel wheel;
+    for (uint64_t d : {5, 5, 70, 5000, 0}) wheel.schedule(d);
+    CHECK(wheel.cancel(5));
+    CHECK(wheel.cancel(5000));
+    CHECK(wheel.cancel(0));   // Due, not yet reported
+    CHECK_FALSE(wheel.cancel(6));
+    CHECK(wheel.pendingCount() == 2);
+    CHECK(wheel.advance(10) == 1);
+    CHECK_FALSE(wheel.cancel(5));
+    CHECK(wheel.advance(10000) == 1);
+
+    std::mt19937_64 rng(9);
+    TimerWheel big(100);
+    std::vector<uint64_t> deadlines;
+    for (int i = 0; i < 2000; ++i) {
+        deadlines.push_back(100 + rng() % (uint64_t(1) << 20));
+        big.schedule(deadlines.back());
+    }
+    big.advance(5000);   // Cascades part of the upper levels
+    size_t live = 0;
+    for (size_t i = 0; i < deadlines.size(); ++i) {
+        if (deadlines[i] <= 5000) continue;
+        if (i % 2) CHECK(big.cancel(deadlines[i]));
+        else ++live;
+    }
+    CHECK(big.pendingCount() == live);
+    CHECK(big.advance(uint64_t(1) << 21) == live);
+}
+
+TEST_CASE("MyContainer - elements with a TTL expire from every view") {
+    MyContainer<int> c;
+    c.enableOrderStatistics();
+    c.enableDistinctCounter();
+    c.addElement(50);              // No TTL: never expires
+    c.addElement(10, 5);
+    c.addElement(30, 100);
+    c.addElement(20, 5);
+    c.addElement(40);
+    c.getSortedIndex();
+    CHECK(c.advanceTime(4) == 0);
+    CHECK(c.size() == 5);
+    CHECK(c.advanceTime(5) == 2);
+    CHECK(c.currentTime() == 5);
+    CHECK(c.getElements() == std::vector<int>{50, 30, 40});
+    CHECK(c.hasCachedSortedIndex());
+    std::vector<int> ascending;
+    for (int x : MyContainer<int>::AscendingOrder(c)) ascending.push_back(x);
+    CHECK(ascending == std::vector<int>{30, 40, 50});
+    CHECK(c.min() == 30);
+    CHECK(c.median() == 40);
+    CHECK(c.approxDistinct() == doctest::Approx(3).epsilon(0.05));
+    CHECK_THROWS_AS(c.advanceTime(4), std::invalid_argument);
+    {
+        MyContainer<int>::AscendingOrder view(c);
+        view.begin();   // Marks an active iteration until end()
+        CHECK_THROWS_AS(c.addElement(99, 1), MyContainer<int>::ActiveIterationError);
+        CHECK_THROWS_AS(c.advanceTime(6), MyContainer<int>::ActiveIterationError);
+        view.end();
+    }
+    CHECK(c.size() == 3);
+
+    c.addElement(60, 10);          // Deadline 15; removal shifts later deadlines along
+    c.remove(50);
+    c.addElement(70);
+    c.addElement(80, 3);
+    c.remove(80);                  // Its timer is cancelled
+    CHECK(c.advanceTime(8) == 0);
+    CHECK(c.advanceTime(15) == 1);
+    CHECK(c.getElements() == std::vector<int>{30, 40, 70});
+    CHECK(c.advanceTime(1000) == 1);
+    CHECK(c.getElements() == std::vector<int>{40, 70});
+    CHECK(c.max() == 70);
+
+    MyContainer<int> u;
+    u.enableUniqueElements();
+    u.addElement(1, 3);
+    CHECK_FALSE(u.addElement(1, 100));   // Duplicate is rejected, its TTL ignored
+    u.addElement(2);
+    CHECK(u.advanceTime(3) == 1);
+    CHECK(u.addElement(1));              // Expired values can be added again
+    CHECK(u.getElements() == std::vector<int>{2, 1});
+
+    MyContainer<int> a, b;
+    a.addElement(1);
+    b.addElement(2, 10);
+    b.addElement(3);
+    a.merge(std::move(b));
+    CHECK(a.advanceTime(10) == 1);
+    CHECK(a.getElements() == std::vector<int>{1, 3});
+    CHECK(b.advanceTime(20) == 0);
+
+    // Clocks differ: the remaining TTL carries over, not the absolute deadline
+    MyContainer<int> early, late;
+    early.advanceTime(100);
+    late.advanceTime(1000);
+    late.addElement(7, 50);     // Deadline 1050 on late's clock, 50 ticks left
+    early.addElement(8, 20);
+    early.merge(std::move(late));
+    CHECK(early.advanceTime(120) == 1);
+    CHECK(early.getElements() == std::vector<int>{7});
+    CHECK(early.advanceTime(149) == 0);
+    CHECK(early.advanceTime(150) == 1);
+    CHECK(early.size() == 0);
+    late.addElement(9, 5);      // late keeps its own clock
+    CHECK(late.advanceTime(1005) == 1);
+
+    MyContainer<int> behind;
+    MyContainer<int> ahead;
+    ahead.advanceTime(500);
+    ahead.addElement(1, 10);
+    behind.merge(std::move(ahead));
+    CHECK(behind.advanceTime(9) == 0);
+    CHECK(behind.advanceTime(10) == 1);
+}